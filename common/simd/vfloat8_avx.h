@@ -92,6 +92,14 @@ namespace embree
       return vfloat8(vfloat4::load(ptr),vfloat4::load(ptr+4));
 #endif
     }
+
+    static __forceinline vfloat8 load( const unsigned short* const ptr ) {
+#if defined(__AVX2__)
+      return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)ptr))),vfloat8(1.0f/65535.0f));
+#else
+      return vfloat8(vfloat4::load(ptr),vfloat4::load(ptr+4));
+#endif
+    }
       
     static __forceinline vfloat8 load ( const void* const ptr) { return _mm256_load_ps((float*)ptr); }
     static __forceinline vfloat8 loadu( const void* const ptr) { return _mm256_loadu_ps((float*)ptr); }
@@ -70,6 +70,25 @@ namespace embree
   {
   }
 
+  void* os_malloc(size_t bytes, HugePageMode& mode)
+  {
+    mode = HUGE_PAGES_NEVER;
+    return os_malloc(bytes);
+  }
+
+  void* os_reserve(size_t bytes, HugePageMode& mode)
+  {
+    mode = HUGE_PAGES_NEVER;
+    return os_reserve(bytes);
+  }
+
+  void os_free(void* ptr, size_t bytes, HugePageMode mode) {
+    os_free(ptr,bytes);
+  }
+
+  size_t os_page_size(HugePageMode mode) {
+    return PAGE_SIZE_4K;
+  }
 }
 #endif
 
@@ -88,15 +107,15 @@ namespace embree
 
 namespace embree
 {
-  __forceinline bool isHugePageCandidate(const size_t bytes) 
+  __forceinline bool isHugePageCandidate(const size_t bytes, const size_t pageSize = PAGE_SIZE_2M) 
   {
     /* try to use huge pages for large allocations */
-    if (bytes >= PAGE_SIZE_2M)
+    if (bytes >= pageSize)
     {
       /* multiple of page size */
-      if ((bytes % PAGE_SIZE_2M) == 0) 
+      if ((bytes % pageSize) == 0) 
         return true;
-      else if (bytes >= 64 * PAGE_SIZE_2M) /* will only introduce a 3% overhead */
+      else if (bytes >= 64 * pageSize) /* will only introduce a 3% overhead */
         return true;
     }
     return false;
@@ -203,6 +222,82 @@ namespace embree
     if (munmap(ptr,bytes) == -1)
       /*throw std::bad_alloc()*/ return;  // we on purpose do not throw an exception when an error occurs, to avoid throwing an exception during error handling
   }
+
+#if !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+
+  size_t os_page_size(HugePageMode mode)
+  {
+    if (mode == HUGE_PAGES_1G      ) return PAGE_SIZE_1G;
+    if (mode == HUGE_PAGES_EXPLICIT) return PAGE_SIZE_2M;
+    return PAGE_SIZE_4K;
+  }
+
+  void* os_malloc(size_t bytes, HugePageMode& mode)
+  {
+    int flags = MAP_PRIVATE | MAP_ANON;
+
+#if !defined(__MACOSX__) && defined(MAP_HUGETLB)
+    /* try 1GB pages from the hugetlbfs pool */
+    if (mode == HUGE_PAGES_1G)
+    {
+      if (isHugePageCandidate(bytes,PAGE_SIZE_1G))
+      {
+        const size_t bytes1G = (bytes+PAGE_SIZE_1G-1) & ~(PAGE_SIZE_1G-1);
+        void* ptr = mmap(0, bytes1G, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB | (30 << MAP_HUGE_SHIFT), -1, 0);
+        if (ptr != nullptr && ptr != MAP_FAILED) return ptr;
+      }
+      mode = HUGE_PAGES_EXPLICIT;
+    }
+
+    /* try 2MB pages from the hugetlbfs pool */
+    if (mode == HUGE_PAGES_EXPLICIT)
+    {
+      if (isHugePageCandidate(bytes,PAGE_SIZE_2M))
+      {
+        const size_t bytes2M = (bytes+PAGE_SIZE_2M-1) & ~(PAGE_SIZE_2M-1);
+        void* ptr = mmap(0, bytes2M, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+        if (ptr != nullptr && ptr != MAP_FAILED) return ptr;
+      }
+      mode = HUGE_PAGES_MADVISE;
+    }
+#else
+    if (mode == HUGE_PAGES_1G || mode == HUGE_PAGES_EXPLICIT)
+      mode = HUGE_PAGES_MADVISE;
+#endif
+
+    /* standard mmap call */
+    bytes = (bytes+PAGE_SIZE_4K-1)&ssize_t(-PAGE_SIZE_4K);
+    void* ptr = (char*) mmap(0, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (ptr == nullptr || ptr == MAP_FAILED) throw std::bad_alloc();
+
+    /* hint for transparent huge pages (THP) */
+#if defined(MADV_HUGEPAGE)
+    if (mode == HUGE_PAGES_MADVISE && (bytes < PAGE_SIZE_2M || madvise(ptr,bytes,MADV_HUGEPAGE) != 0))
+      mode = HUGE_PAGES_NEVER;
+#else
+    mode = HUGE_PAGES_NEVER;
+#endif
+    return ptr;
+  }
+
+  void* os_reserve(size_t bytes, HugePageMode& mode)
+  {
+    /* linux always allocates pages on demand, thus just call allocate */
+    return os_malloc(bytes,mode);
+  }
+
+  void os_free(void* ptr, size_t bytes, HugePageMode mode)
+  {
+    if (bytes == 0)
+      return;
+
+    const size_t pageSize = os_page_size(mode);
+    bytes = (bytes+pageSize-1)&ssize_t(-pageSize);
+    if (munmap(ptr,bytes) == -1)
+      return; // do not throw an exception as this may get called during error handling
+  }
 }
 
 #endif
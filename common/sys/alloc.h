@@ -84,6 +84,29 @@ namespace embree
   void  os_free   (void* ptr, size_t bytes);
   void  os_advise (void* ptr, size_t bytes);
 
+  /*! huge page policies for OS allocations */
+  enum HugePageMode 
+  {
+    HUGE_PAGES_NEVER    = 0, //!< use standard pages only
+    HUGE_PAGES_MADVISE  = 1, //!< hint transparent huge pages through madvise
+    HUGE_PAGES_EXPLICIT = 2, //!< map 2MB pages from the hugetlbfs pool, falls back to HUGE_PAGES_MADVISE
+    HUGE_PAGES_1G       = 3  //!< map 1GB pages from the hugetlbfs pool, falls back to HUGE_PAGES_EXPLICIT
+  };
+
+  /*! allocates pages directly from OS using some huge page policy,
+   *  mode gets set to the policy that finally got applied */
+  void* os_malloc (size_t bytes, HugePageMode& mode);
+
+  /*! reserves address space using some huge page policy, pages
+   *  have to get committed with os_commit before use */
+  void* os_reserve(size_t bytes, HugePageMode& mode);
+
+  /*! frees pages allocated with the policy os_malloc applied */
+  void  os_free   (void* ptr, size_t bytes, HugePageMode mode);
+
+  /*! returns the page size used for some applied huge page policy */
+  size_t os_page_size (HugePageMode mode);
+
   /*! allocator that performs OS allocations */
   template<typename T>
     struct os_allocator
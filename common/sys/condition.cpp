@@ -38,6 +38,10 @@ namespace embree
       SleepConditionVariableCS(&cond, (LPCRITICAL_SECTION)mutex_in.mutex, INFINITE);
     }
 
+    __forceinline void notify_one() {
+      WakeConditionVariable(&cond);
+    }
+
     __forceinline void notify_all() {
       WakeAllConditionVariable(&cond);
     }
@@ -81,6 +85,11 @@ namespace embree
       }
     }
 
+    /* waking a single thread is not supported, waiters have to check their predicate anyway */
+    __forceinline void notify_one() {
+      notify_all();
+    }
+
     __forceinline void notify_all() 
     {
       /* we support only one broadcast at a given time */
@@ -118,6 +127,10 @@ namespace embree
       pthread_cond_wait(&cond, (pthread_mutex_t*)mutex.mutex); 
     }
     
+    __forceinline void notify_one() { 
+      pthread_cond_signal(&cond); 
+    }
+
     __forceinline void notify_all() { 
       pthread_cond_broadcast(&cond); 
     }
@@ -142,6 +155,10 @@ namespace embree
     ((ConditionImplementation*) cond)->wait(mutex);
   }
 
+  void ConditionSys::notify_one() { 
+    ((ConditionImplementation*) cond)->notify_one();
+  }
+
   void ConditionSys::notify_all() { 
     ((ConditionImplementation*) cond)->notify_all();
   }
@@ -26,6 +26,7 @@ namespace embree
     ConditionSys();
     ~ConditionSys();
     void wait( class MutexSys& mutex );
+    void notify_one();
     void notify_all();
 
     template<typename Predicate>
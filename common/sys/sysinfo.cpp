@@ -523,3 +523,140 @@ namespace embree
 }
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+/// CPU Topology
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <algorithm>
+
+#if defined(__LINUX__)
+
+#include <sched.h>
+
+namespace embree
+{
+  static int readSysInt(const std::string& fileName, int def = -1)
+  {
+    std::ifstream fs(fileName.c_str());
+    int value = def;
+    if (!(fs >> value)) return def;
+    return value;
+  }
+
+  /* parses CPU lists of the form "0-3,8,10-11" */
+  static bool readSysCPUList(const std::string& fileName, std::vector<int>& cpus)
+  {
+    std::ifstream fs(fileName.c_str());
+    if (fs.fail()) return false;
+    
+    int first;
+    while (fs >> first)
+    {
+      int last = first;
+      if (fs.peek() == '-') { fs.ignore(); fs >> last; }
+      for (int i=first; i<=last; i++) cpus.push_back(i);
+      if (fs.peek() != ',') break;
+      fs.ignore();
+    }
+    return cpus.size() != 0;
+  }
+
+  static int readSysFirstCPU(const std::string& fileName, int def)
+  {
+    std::vector<int> cpus;
+    if (!readSysCPUList(fileName,cpus)) return def;
+    return *std::min_element(cpus.begin(),cpus.end());
+  }
+
+  static std::vector<CPUTopology> readCPUTopology()
+  {
+    const std::string sys = "/sys/devices/system/";
+    std::vector<CPUTopology> topology(getNumberOfLogicalThreads());
+    
+    for (size_t cpuID=0; cpuID<topology.size(); cpuID++)
+    {
+      const std::string cpu = sys + "cpu/cpu" + std::to_string((long long)cpuID) + "/";
+      CPUTopology& t = topology[cpuID];
+      
+      /* offline CPUs have no topology information */
+      t.package = readSysInt(cpu+"topology/physical_package_id");
+      if (t.package < 0) continue;
+      t.core = readSysFirstCPU(cpu+"topology/thread_siblings_list",int(cpuID));
+      t.node = 0;
+      
+      /* the highest cache level defines the core complex */
+      t.cache = t.core;
+      for (size_t i=0, maxLevel=0; ; i++)
+      {
+        const std::string index = cpu + "cache/index" + std::to_string((long long)i) + "/";
+        const int level = readSysInt(index+"level");
+        if (level < 0) break;
+        if (size_t(level) <= maxLevel) continue;
+        maxLevel = level;
+        t.cache = readSysFirstCPU(index+"shared_cpu_list",t.core);
+      }
+    }
+
+    /* node IDs can be sparse, but there are never more nodes than CPUs */
+    for (size_t nodeID=0; nodeID<topology.size(); nodeID++)
+    {
+      std::vector<int> cpus;
+      if (!readSysCPUList(sys + "node/node" + std::to_string((long long)nodeID) + "/cpulist",cpus)) continue;
+      for (size_t i=0; i<cpus.size(); i++)
+        if (size_t(cpus[i]) < topology.size()) topology[cpus[i]].node = int(nodeID);
+    }
+    return topology;
+  }
+
+  ssize_t getCurrentCPU() {
+    return sched_getcpu();
+  }
+}
+
+#else
+
+namespace embree
+{
+  static std::vector<CPUTopology> readCPUTopology() {
+    return std::vector<CPUTopology>();
+  }
+
+  ssize_t getCurrentCPU() {
+    return -1;
+  }
+}
+
+#endif
+
+namespace embree
+{
+  CPUTopology getCPUTopology(ssize_t cpuID)
+  {
+    static const std::vector<CPUTopology> topology = readCPUTopology();
+    if (cpuID < 0 || size_t(cpuID) >= topology.size()) return CPUTopology();
+    return topology[cpuID];
+  }
+
+  unsigned int getNumberOfLogicalThreads(CPUTopologyLevel level)
+  {
+    const CPUTopology cpu0 = getCPUTopology(0);
+    if (!cpu0.valid()) return getNumberOfLogicalThreads();
+    
+    unsigned int N = 0;
+    for (size_t i=0; i<getNumberOfLogicalThreads(); i++)
+      N += cpu0.distance(getCPUTopology(i)) <= level;
+    return N;
+  }
+
+  unsigned int getNumberOfNUMANodes()
+  {
+    static unsigned int numNodes = 0;
+    if (numNodes) return numNodes;
+
+    int maxNode = 0;
+    for (size_t i=0; i<getNumberOfLogicalThreads(); i++)
+      maxNode = std::max(maxNode,getCPUTopology(i).node);
+    return numNodes = maxNode+1;
+  }
+}
@@ -22,6 +22,7 @@
   #define PAGE_SIZE 4096
 #endif
 
+#define PAGE_SIZE_1G (size_t(1024)*1024*1024)
 #define PAGE_SIZE_2M (2*1024*1024)
 #define PAGE_SIZE_4K (4*1024)
 
@@ -172,6 +173,54 @@ namespace embree
 
   /*! return the number of logical threads of the system */
   unsigned int getNumberOfLogicalThreads();
+
+  /*! distance of two logical CPUs in the CPU topology */
+  enum CPUTopologyLevel
+  {
+    CPU_TOPOLOGY_CORE    = 0,  //!< hardware threads of the same core
+    CPU_TOPOLOGY_CACHE   = 1,  //!< cores sharing the last level cache (core complex)
+    CPU_TOPOLOGY_NODE    = 2,  //!< cores of the same NUMA node
+    CPU_TOPOLOGY_PACKAGE = 3,  //!< cores of the same socket
+    CPU_TOPOLOGY_REMOTE  = 4,  //!< cores of different sockets or unknown topology
+    CPU_TOPOLOGY_LEVELS  = 5
+  };
+
+  /*! location of a logical CPU in the CPU topology */
+  struct CPUTopology
+  {
+    CPUTopology () 
+      : core(-1), cache(-1), node(-1), package(-1) {}
+
+    /*! checks if topology information is available */
+    __forceinline bool valid() const { return package >= 0; }
+
+    /*! returns the closest topology level two logical CPUs share */
+    __forceinline CPUTopologyLevel distance(const CPUTopology& other) const
+    {
+      if (!valid() || !other.valid() || package != other.package) return CPU_TOPOLOGY_REMOTE;
+      if (core  == other.core ) return CPU_TOPOLOGY_CORE;
+      if (cache == other.cache) return CPU_TOPOLOGY_CACHE;
+      if (node  == other.node ) return CPU_TOPOLOGY_NODE;
+      return CPU_TOPOLOGY_PACKAGE;
+    }
+
+    int core;     //!< first logical CPU of the core
+    int cache;    //!< first logical CPU sharing the last level cache
+    int node;     //!< NUMA node
+    int package;  //!< physical package ID
+  };
+
+  /*! returns the location of a logical CPU in the CPU topology, invalid if unknown */
+  CPUTopology getCPUTopology(ssize_t cpuID);
+
+  /*! returns the number of logical threads within the given topology level of logical CPU 0 */
+  unsigned int getNumberOfLogicalThreads(CPUTopologyLevel level);
+
+  /*! returns the number of NUMA nodes of the system */
+  unsigned int getNumberOfNUMANodes();
+
+  /*! returns the logical CPU the calling thread currently runs on, -1 if unknown */
+  ssize_t getCurrentCPU();
   
   /*! returns the size of the terminal window in characters */
   int getTerminalWidth();
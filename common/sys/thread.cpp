@@ -169,13 +169,15 @@ namespace embree
 
 #if defined(__LINUX__)
 
-#include <fstream>
-#include <sstream>
 #include <algorithm>
+#include <tuple>
+#include <sched.h>
 
 namespace embree
 {
-  /* changes thread ID mapping such that we first fill up all thread on one core */
+  /* changes thread ID mapping such that we first fill up all threads of
+   * one core, then all cores sharing the last level cache, then all cores
+   * of one NUMA node and socket */
   size_t mapThreadID(size_t threadID)
   {
     static MutexSys mutex;
@@ -184,24 +186,23 @@ namespace embree
 
     if (threadIDs.size() == 0)
     {
-      /* parse thread/CPU topology */
-      for (size_t cpuID=0;;cpuID++)
-      {
-        std::fstream fs;
-        std::string cpu = std::string("/sys/devices/system/cpu/cpu") + std::to_string((long long)cpuID) + std::string("/topology/thread_siblings_list");
-        fs.open (cpu.c_str(), std::fstream::in);
-        if (fs.fail()) break;
-
-        int i;
-        while (fs >> i) 
-        {
-          if (std::none_of(threadIDs.begin(),threadIDs.end(),[&] (int id) { return id == i; }))
-            threadIDs.push_back(i);
-          if (fs.peek() == ',') 
-            fs.ignore();
-        }
-        fs.close();
-      }
+      /* offline CPUs and CPUs excluded by the affinity mask of the process are not usable */
+      cpu_set_t allowed;
+      CPU_ZERO(&allowed);
+      const bool hasMask = sched_getaffinity(0,sizeof(allowed),&allowed) == 0;
+      auto usable = [&] (size_t cpuID) { 
+        return !hasMask || cpuID >= CPU_SETSIZE || CPU_ISSET(cpuID,&allowed); 
+      };
+
+      for (size_t cpuID=0; cpuID<getNumberOfLogicalThreads(); cpuID++)
+        threadIDs.push_back(cpuID);
+
+      /* unusable CPUs go last, then CPUs without topology information, both in their original order */
+      auto key = [&] (size_t cpuID) {
+        const CPUTopology t = getCPUTopology(cpuID);
+        return std::make_tuple(!usable(cpuID),!t.valid(),t.package,t.node,t.cache,t.core,cpuID);
+      };
+      std::sort(threadIDs.begin(),threadIDs.end(),[&] (size_t a, size_t b) { return key(a) < key(b); });
 
 #if 0
       for (size_t i=0;i<threadIDs.size();i++)
@@ -237,6 +238,14 @@ namespace embree
       WARNING("pthread_setaffinity_np failed"); // on purpose only a warning
   }
 }
+#else
+
+namespace embree
+{
+  size_t mapThreadID(size_t threadID) {
+    return threadID;
+  }
+}
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////
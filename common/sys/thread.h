@@ -36,6 +36,9 @@ namespace embree
   /*! set affinity of the calling thread */
   void setAffinity(ssize_t affinity);
 
+  /*! returns the logical CPU a thread with the given affinity gets pinned to */
+  size_t mapThreadID(size_t threadID);
+
   /*! the thread calling this function gets yielded */
   void yield();
 
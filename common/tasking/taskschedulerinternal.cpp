@@ -22,30 +22,78 @@
 namespace embree
 {
   size_t TaskScheduler::g_numThreads = 0;
+  std::atomic<size_t> TaskScheduler::g_idleSpinRounds(32);
+  std::atomic<size_t> TaskScheduler::g_idleBackoffRounds(0);
+  std::atomic<bool> TaskScheduler::g_idleParking(false);
+  std::atomic<size_t> TaskScheduler::g_numParks(0);
   __thread TaskScheduler* TaskScheduler::g_instance = nullptr;
   __thread TaskScheduler::Thread* TaskScheduler::thread_local_thread = nullptr;
   TaskScheduler::ThreadPool* TaskScheduler::threadPool = nullptr;
 
   template<typename Predicate, typename Body>
-  __forceinline void TaskScheduler::steal_loop(Thread& thread, const Predicate& pred, const Body& body)
+  __forceinline void TaskScheduler::steal_loop(Thread& thread, const Predicate& pred, const Body& body, bool allowParking)
   {
-    while (true)
+    static const size_t maxBackoffMicroSeconds = 1024;
+    
+    for (size_t i=0; ; i++)
     {
-      /*! some rounds that yield */
-      for (size_t i=0; i<32; i++)
+      /*! some spinning rounds */
+      const size_t threadCount = thread.threadCount();
+      for (size_t j=0; j<1024; j+=threadCount)
       {
-        /*! some spinning rounds */
-        const size_t threadCount = thread.threadCount();
-        for (size_t j=0; j<1024; j+=threadCount)
-        {
-          if (!pred()) return;
-          if (thread.scheduler->steal_from_other_threads(thread)) {
-            i=j=0;
-            body();
-          }
+        if (!pred()) return;
+        if (thread.scheduler->steal_from_other_threads(thread)) {
+          i=j=0;
+          body();
         }
+      }
+
+      /*! spinning rounds that yield, by default forever */
+      const size_t spinRounds = g_idleSpinRounds;
+      const size_t backoffRounds = g_idleBackoffRounds;
+      const bool parking = allowParking && g_idleParking;
+      if (i < spinRounds || (backoffRounds == 0 && !parking)) {
         yield();
+        continue;
+      }
+
+      /*! sleeping rounds with exponential backoff */
+      if (i < spinRounds+backoffRounds || !parking) {
+        const size_t k = min(i-spinRounds,size_t(10));
+        sleepSeconds(1E-6*double(min(size_t(1) << k,maxBackoffMicroSeconds)));
+        continue;
+      }
+
+      /*! park until new tasks get spawned or the predicate changes, each
+       *  spawned task wakes one thread, which wakes further threads when it
+       *  spawns tasks itself */
+      TaskScheduler* scheduler = thread.scheduler.ptr;
+      size_t generation = 0;
+      {
+        Lock<MutexSys> lock(scheduler->mutex);
+        generation = scheduler->wakeGeneration;
+        scheduler->numIdleThreads++;
+        scheduler->numParkedThreads++;
+      }
+
+      /*! steal once more after announcing to not miss tasks spawned in the meantime */
+      const bool stolen = pred() && scheduler->steal_from_other_threads(thread);
+      {
+        Lock<MutexSys> lock(scheduler->mutex);
+        if (!stolen) 
+        {
+          g_numParks++;
+          scheduler->idleCondition.wait(scheduler->mutex, [&] () { 
+              if (scheduler->wakeTokens > 0) { scheduler->wakeTokens--; return true; }
+              return scheduler->wakeGeneration != generation || !pred(); 
+            });
+        }
+        scheduler->numParkedThreads--;
+        scheduler->wakeTokens = min(scheduler->wakeTokens,scheduler->numParkedThreads);
       }
+      scheduler->numIdleThreads--;
+      i = 0;
+      if (stolen) body();
     }
   }
 
@@ -135,7 +183,7 @@ namespace embree
   }
 
   TaskScheduler::ThreadPool::ThreadPool(bool set_affinity)
-    : numThreads(0), numThreadsRunning(0), set_affinity(set_affinity), running(false) {}
+    : numThreads(0), numThreadsRunning(0), set_affinity(set_affinity), running(false), highestPriority(-1) {}
 
   __dllexport void TaskScheduler::ThreadPool::startThreads()
   {
@@ -152,6 +200,7 @@ namespace embree
     numThreads = newNumThreads;
     if (!startThreads && !running) return;
     running = true;
+    computeVictims();
     size_t numThreadsActive = numThreadsRunning;
 
     mutex.lock();
@@ -191,7 +240,15 @@ namespace embree
   __dllexport void TaskScheduler::ThreadPool::add(const Ref<TaskScheduler>& scheduler)
   {
     mutex.lock();
-    schedulers.push_back(scheduler);
+    std::list<Ref<TaskScheduler> >::iterator it = schedulers.begin();
+    while (it != schedulers.end() && (*it)->priority >= scheduler->priority) it++;
+    schedulers.insert(it,scheduler);
+    highestPriority = schedulers.front()->priority;
+
+    /* wake up parked threads of lower priority schedulers such that they get preempted */
+    for (it = schedulers.begin(); it != schedulers.end(); it++)
+      if ((*it)->priority < scheduler->priority && (*it)->numIdleThreads > 0)
+        (*it)->wakeIdleThreads();
     mutex.unlock();
     condition.notify_all();
   }
@@ -202,11 +259,76 @@ namespace embree
     for (std::list<Ref<TaskScheduler> >::iterator it = schedulers.begin(); it != schedulers.end(); it++) {
       if (scheduler == *it) {
         schedulers.erase(it);
+        highestPriority = schedulers.empty() ? -1 : int(schedulers.front()->priority);
         return;
       }
     }
   }
 
+  Ref<TaskScheduler> TaskScheduler::ThreadPool::select(size_t globalThreadIndex)
+  {
+    /* count schedulers of highest priority */
+    const Priority priority = schedulers.front()->priority;
+    size_t numSchedulers = 0;
+    for (auto& scheduler : schedulers) {
+      if (scheduler->priority != priority) break;
+      numSchedulers++;
+    }
+    
+    /* distribute threads round robin among them */
+    std::list<Ref<TaskScheduler> >::iterator it = schedulers.begin();
+    std::advance(it,globalThreadIndex % numSchedulers);
+    return *it;
+  }
+
+  void TaskScheduler::ThreadPool::computeVictims()
+  {
+    Lock<MutexSys> lock(victimsMutex);
+    const size_t N = numThreads;
+    victims.clear();
+    victims.resize(N);
+    if (!set_affinity) return;
+
+    std::vector<CPUTopology> topology(N);
+    for (size_t t=1; t<N; t++)
+      topology[t] = getCPUTopology(cpuID(t));
+
+    /* thread 0 is not a worker thread, other threads are ordered by
+     * topology distance and round robin within one level */
+    for (size_t t=1; t<N; t++)
+    {
+      if (!topology[t].valid()) continue;
+      for (size_t i=1; i<N; i++) {
+        const size_t other = (t+i)%N;
+        if (other != 0) victims[t].push_back(other);
+      }
+      std::stable_sort(victims[t].begin(),victims[t].end(),[&] (size_t a, size_t b) {
+          return topology[t].distance(topology[a]) < topology[t].distance(topology[b]);
+        });
+    }
+  }
+
+  void TaskScheduler::ThreadPool::getVictims(size_t globalThreadIndex, std::vector<size_t>& victims_o)
+  {
+    Lock<MutexSys> lock(victimsMutex);
+    if (globalThreadIndex < victims.size()) victims_o = victims[globalThreadIndex];
+    else victims_o.clear();
+  }
+
+  bool TaskScheduler::ThreadPool::join_higher_priority(int priority, size_t globalThreadIndex)
+  {
+    Ref<TaskScheduler> scheduler = NULL;
+    ssize_t threadIndex = -1;
+    {
+      Lock<MutexSys> lock(mutex);
+      if (schedulers.empty() || schedulers.front()->priority <= priority) return false;
+      scheduler = schedulers.front();
+      threadIndex = scheduler->allocThreadIndex();
+    }
+    scheduler->thread_loop(threadIndex,globalThreadIndex,true);
+    return true;
+  }
+
   void TaskScheduler::ThreadPool::thread_loop(size_t globalThreadIndex)
   {
     while (globalThreadIndex < numThreadsRunning)
@@ -217,19 +339,22 @@ namespace embree
         Lock<MutexSys> lock(mutex);
         condition.wait(mutex, [&] () { return globalThreadIndex >= numThreadsRunning || !schedulers.empty(); });
         if (globalThreadIndex >= numThreadsRunning) break;
-        scheduler = schedulers.front();
+        scheduler = select(globalThreadIndex);
         threadIndex = scheduler->allocThreadIndex();
       }
-      scheduler->thread_loop(threadIndex);
+      scheduler->thread_loop(threadIndex,globalThreadIndex,true);
     }
   }
   
-  TaskScheduler::TaskScheduler()
-    : threadCounter(0), anyTasksRunning(0), hasRootTask(false) 
+  TaskScheduler::TaskScheduler(Priority priority)
+    : threadCounter(0), anyTasksRunning(0), hasRootTask(false), numIdleThreads(0), numParkedThreads(0), wakeTokens(0), wakeGeneration(0), priority(priority)
   {
     threadLocal.resize(2*getNumberOfLogicalThreads()); // FIXME: this has to be 2x as in the compatibility join mode with rtcCommit the worker threads also join. When disallowing rtcCommit to join a build we can remove the 2x.
     for (size_t i=0; i<threadLocal.size(); i++)
       threadLocal[i].store(nullptr);
+    poolThreadLocal.resize(getNumberOfLogicalThreads());
+    for (size_t i=0; i<poolThreadLocal.size(); i++)
+      poolThreadLocal[i].store(nullptr);
   }
   
   TaskScheduler::~TaskScheduler() 
@@ -288,6 +413,22 @@ namespace embree
     hasRootTask = false;
   }
 
+  __dllexport void TaskScheduler::wakeIdleThreads(size_t numThreads)
+  {
+    Lock<MutexSys> lock(mutex);
+
+    if (numThreads >= numParkedThreads) {
+      wakeGeneration++;
+      idleCondition.notify_all();
+      return;
+    }
+
+    const size_t numWake = min(numThreads,numParkedThreads-wakeTokens);
+    wakeTokens += numWake;
+    for (size_t i=0; i<numWake; i++)
+      idleCondition.notify_one();
+  }
+
   void TaskScheduler::wait_for_threads(size_t threadCount)
   {
     while (threadCounter < threadCount-1)
@@ -313,25 +454,38 @@ namespace embree
     return thread->scheduler->cancellingException == nullptr;
   }
 
-  std::exception_ptr TaskScheduler::thread_loop(size_t threadIndex)
+  std::exception_ptr TaskScheduler::thread_loop(size_t threadIndex, ssize_t globalThreadIndex, bool preemptible)
   {
     /* allocate thread structure */
-    std::unique_ptr<Thread> mthread(new Thread(threadIndex,this)); // too large for stack allocation
+    const ssize_t cpuID = globalThreadIndex >= 0 ? threadPool->cpuID(globalThreadIndex) : -1;
+    std::unique_ptr<Thread> mthread(new Thread(threadIndex,this,globalThreadIndex,cpuID)); // too large for stack allocation
     Thread& thread = *mthread;
+    if (globalThreadIndex >= 0) threadPool->getVictims(globalThreadIndex,thread.victims);
     threadLocal[threadIndex].store(&thread);
+    if (globalThreadIndex >= 0) poolThreadLocal[globalThreadIndex].store(&thread);
     Thread* oldThread = swapThread(&thread);
 
+    /* pool threads get preempted by task schedulers of higher priority */
+    auto preempted = [&] () { return preemptible && threadPool->maxPriority() > int(priority); };
+
     /* main thread loop */
     while (anyTasksRunning)
     {
       steal_loop(thread,
-                 [&] () { return anyTasksRunning > 0; },
+                 [&] () { return anyTasksRunning > 0 && !preempted(); },
                  [&] () { 
                    anyTasksRunning++;
                    while (thread.tasks.execute_local(thread,nullptr));
                    anyTasksRunning--;
-                 });
+                 },
+                 true);
+
+      /* help higher priority schedulers between tasks, our task stack is empty here */
+      if (preempted()) {
+        if (!threadPool->join_higher_priority(priority,globalThreadIndex)) yield();
+      }
     }
+    if (globalThreadIndex >= 0) poolThreadLocal[globalThreadIndex].store(nullptr);
     threadLocal[threadIndex].store(nullptr);
     swapThread(oldThread);
 
@@ -364,9 +518,24 @@ namespace embree
     const size_t threadIndex = thread.threadIndex;
     const size_t threadCount = this->threadCounter;
 
-    for (size_t i=1; i<threadCount; i++) 
+    /* pinned threads first steal from threads of the same core, then
+     * from the same core complex, NUMA node, socket, and finally from
+     * remote sockets, using the victim order precomputed at thread pool start */
+    for (size_t i=0; i<thread.victims.size(); i++)
     {
+      Thread* othread = poolThreadLocal[thread.victims[i]].load();
+      if (!othread)
+        continue;
+
       __pause_cpu(32);
+      if (othread->tasks.steal(thread)) 
+        return true;      
+    }
+
+    /* other threads steal round robin, pinned threads only still have to try non pool threads */
+    const bool skipPoolThreads = thread.victims.size() > 0;
+    for (size_t i=1; i<threadCount; i++) 
+    {
       size_t otherThreadIndex = threadIndex+i;
       if (otherThreadIndex >= threadCount) otherThreadIndex -= threadCount;
 
@@ -374,6 +543,10 @@ namespace embree
       if (!othread)
         continue;
 
+      if (skipPoolThreads && othread->globalThreadIndex >= 0)
+        continue;
+
+      __pause_cpu(32);
       if (othread->tasks.steal(thread)) 
         return true;      
     }
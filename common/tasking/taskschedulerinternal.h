@@ -20,6 +20,7 @@
 #include "../sys/alloc.h"
 #include "../sys/barrier.h"
 #include "../sys/thread.h"
+#include "../sys/sysinfo.h"
 #include "../sys/mutex.h"
 #include "../sys/condition.h"
 #include "../sys/ref.h"
@@ -38,6 +39,9 @@ namespace embree
     static const size_t TASK_STACK_SIZE = 2*1024;           //!< task structure stack
     static const size_t CLOSURE_STACK_SIZE = 256*1024;    //!< stack for task closures
 
+    /*! priority classes of task schedulers sharing the thread pool */
+    enum Priority { PRIORITY_LOW = 0, PRIORITY_NORMAL = 1, PRIORITY_HIGH = 2 };
+
     struct Thread;
     
     /*! virtual interface for all tasks */
@@ -167,8 +171,8 @@ namespace embree
     {
       ALIGNED_STRUCT;
 
-      Thread (size_t threadIndex, const Ref<TaskScheduler>& scheduler)
-      : threadIndex(threadIndex), task(nullptr), scheduler(scheduler) {}
+      Thread (size_t threadIndex, const Ref<TaskScheduler>& scheduler, ssize_t globalThreadIndex = -1, ssize_t cpuID = -1)
+      : threadIndex(threadIndex), task(nullptr), scheduler(scheduler), globalThreadIndex(globalThreadIndex), topology(getCPUTopology(cpuID)) {}
 
       __forceinline size_t threadCount() {
         return scheduler->threadCounter;
@@ -178,6 +182,9 @@ namespace embree
       TaskQueue tasks;                 //!< local task queue
       Task* task;                      //!< current active task
       Ref<TaskScheduler> scheduler;     //!< pointer to task scheduler
+      ssize_t globalThreadIndex;       //!< index of the thread in the thread pool, -1 for other threads
+      CPUTopology topology;            //!< location of the thread in the CPU topology, invalid if not pinned
+      std::vector<size_t> victims;     //!< thread pool indices to steal from ordered by topology distance, empty if not pinned
     };
 
     /*! pool of worker threads */
@@ -203,6 +210,27 @@ namespace embree
 
       /*! main loop for all threads */
       void thread_loop(size_t threadIndex);
+
+      /*! returns the highest priority of all registered task schedulers, or -1 */
+      __forceinline int maxPriority() const { return highestPriority; }
+
+      /*! lets a worker thread join a task scheduler of higher priority, returns false if there is none */
+      bool join_higher_priority(int priority, size_t globalThreadIndex);
+
+      /*! returns the logical CPU a worker thread is pinned to, or -1 */
+      ssize_t cpuID(size_t globalThreadIndex) const { 
+        return set_affinity ? ssize_t(mapThreadID(globalThreadIndex)) : -1; 
+      }
+
+      /*! copies the victims of some pinned worker thread */
+      void getVictims(size_t globalThreadIndex, std::vector<size_t>& victims);
+
+    private:
+      /*! selects a task scheduler of highest priority, threads are distributed round robin among equal priorities */
+      Ref<TaskScheduler> select(size_t globalThreadIndex);
+
+      /*! orders the victims of all pinned worker threads by topology distance */
+      void computeVictims();
       
     private:
       std::atomic<size_t> numThreads;
@@ -214,10 +242,15 @@ namespace embree
     private:
       MutexSys mutex;
       ConditionSys condition;
-      std::list<Ref<TaskScheduler> > schedulers;
+      std::list<Ref<TaskScheduler> > schedulers; //!< sorted by decreasing priority
+      std::atomic<int> highestPriority;
+
+    private:
+      MutexSys victimsMutex;
+      std::vector<std::vector<size_t> > victims; //!< victims of each worker thread ordered by topology distance
     };
 
-    TaskScheduler ();
+    TaskScheduler (Priority priority = PRIORITY_NORMAL);
     ~TaskScheduler ();
 
     /*! initializes the task scheduler */
@@ -236,14 +269,19 @@ namespace embree
     /*! wait for some number of threads available (threadCount includes main thread) */
     void wait_for_threads(size_t threadCount);
 
-    /*! thread loop for all worker threads */
-    std::exception_ptr thread_loop(size_t threadIndex);
+    /*! thread loop for all worker threads, globalThreadIndex is the index of thread pool threads, 
+     *  preemptible threads help task schedulers of higher priority between tasks */
+    std::exception_ptr thread_loop(size_t threadIndex, ssize_t globalThreadIndex = -1, bool preemptible = false);
 
     /*! steals a task from a different thread */
     bool steal_from_other_threads(Thread& thread);
 
+    /*! steals tasks until the predicate gets false, idle threads may park if allowed */
     template<typename Predicate, typename Body>
-      static void steal_loop(Thread& thread, const Predicate& pred, const Body& body);
+      static void steal_loop(Thread& thread, const Predicate& pred, const Body& body, bool allowParking = false);
+
+    /*! wakes up some number of threads parked in steal_loop, by default all of them */
+    __dllexport void wakeIdleThreads(size_t numThreads = size_t(-1));
 
     /* spawn a new task at the top of the threads task stack */
     template<typename Closure>
@@ -269,6 +307,7 @@ namespace embree
 
       while (thread.tasks.execute_local(thread,nullptr));
       anyTasksRunning--;
+      if (numIdleThreads > 0) wakeIdleThreads();
       if (useThreadPool) removeScheduler(this);
       
       threadLocal[threadIndex] = nullptr;
@@ -293,8 +332,11 @@ namespace embree
     static __forceinline void spawn(size_t size, const Closure& closure) 
     {
       Thread* thread = TaskScheduler::thread();
-      if (likely(thread != nullptr)) thread->tasks.push_right(*thread,size,closure);
-      else                           instance()->spawn_root(closure,size);
+      if (likely(thread != nullptr)) {
+        thread->tasks.push_right(*thread,size,closure);
+        if (unlikely(thread->scheduler->numIdleThreads > 0)) thread->scheduler->wakeIdleThreads(1);
+      }
+      else instance()->spawn_root(closure,size);
     }
 
     /* spawn a new task at the top of the threads task stack */
@@ -350,12 +392,26 @@ namespace embree
 
   private:
     std::vector<atomic<Thread*>> threadLocal;
+    std::vector<atomic<Thread*>> poolThreadLocal; //!< thread pool threads indexed by their global thread index
     std::atomic<size_t> threadCounter;
     std::atomic<size_t> anyTasksRunning;
     std::atomic<bool> hasRootTask;
     std::exception_ptr cancellingException;
     MutexSys mutex;
     ConditionSys condition;
+    ConditionSys idleCondition;           //!< parked threads wait on this condition
+    std::atomic<size_t> numIdleThreads;   //!< number of threads that are about to park or are parked
+    size_t numParkedThreads;              //!< number of threads that are about to park or are parked, protected by mutex
+    size_t wakeTokens;                    //!< number of parked threads to wake up, protected by mutex
+    size_t wakeGeneration;                //!< incremented when all parked threads have to wake up, protected by mutex
+    const Priority priority;              //!< priority of this task scheduler in the thread pool
+
+  public:
+    /*! idle policy of worker threads, shared by all devices */
+    static std::atomic<size_t> g_idleSpinRounds;    //!< number of spinning steal rounds before backing off
+    static std::atomic<size_t> g_idleBackoffRounds; //!< number of sleep rounds with exponential backoff before parking
+    static std::atomic<bool> g_idleParking;         //!< enables parking of idle worker threads
+    static std::atomic<size_t> g_numParks;          //!< number of times worker threads got parked
 
   private:
     static size_t g_numThreads;
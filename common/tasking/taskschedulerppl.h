@@ -34,6 +34,9 @@ namespace embree
 {  
   struct TaskScheduler
   {
+    /*! priority classes of scene builds, ignored by PPL */
+    enum Priority { PRIORITY_LOW = 0, PRIORITY_NORMAL = 1, PRIORITY_HIGH = 2 };
+
     /*! initializes the task scheduler */
     static void create(size_t numThreads, bool set_affinity, bool start_threads);
 
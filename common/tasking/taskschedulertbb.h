@@ -35,6 +35,21 @@ namespace embree
 {  
   struct TaskScheduler
   {
+    /*! priority classes of scene builds */
+    enum Priority { PRIORITY_LOW = 0, PRIORITY_NORMAL = 1, PRIORITY_HIGH = 2 };
+
+#if defined(__TBB_TASK_PRIORITY) && __TBB_TASK_PRIORITY
+    /*! maps priority classes to TBB task group priorities */
+    static __forceinline tbb::priority_t priority(Priority priority) 
+    {
+      switch (priority) {
+      case PRIORITY_LOW : return tbb::priority_low;
+      case PRIORITY_HIGH: return tbb::priority_high;
+      default           : return tbb::priority_normal;
+      }
+    }
+#endif
+
     /*! initializes the task scheduler */
     static void create(size_t numThreads, bool set_affinity, bool start_threads);
 
@@ -143,7 +143,7 @@ enum RTCParameter {
                                                 instance). The size is specified as an
                                                 integer number of bytes. The software
                                                 cache cannot be configured during
-                                                rendering. (write only) */
+                                                rendering. (read/write) */
 
   RTC_CONFIG_INTERSECT1 = 1,                  //!< checks if rtcIntersect1 is supported (read only)
   RTC_CONFIG_INTERSECT4 = 2,                  //!< checks if rtcIntersect4 is supported (read only)
@@ -172,6 +172,30 @@ enum RTCParameter {
 
   RTC_CONFIG_COMMIT_JOIN = 23,               //!< checks if rtcCommitJoin can be used to join build operation (not supported when compiled with some older TBB versions)
   RTC_CONFIG_COMMIT_THREAD = 24,             //!< checks if rtcCommitThread is available (not supported when compiled with some older TBB versions)
+
+  RTC_SOFTWARE_CACHE_USED_BYTES = 25,        //!< returns the number of bytes currently occupied by cached data in the software cache (read only)
+  RTC_SOFTWARE_CACHE_ACCESSES = 26,          //!< returns the number of software cache lookups since the last statistics reset (read only)
+  RTC_SOFTWARE_CACHE_HITS = 27,              //!< returns the number of software cache lookups that found valid data (read only)
+  RTC_SOFTWARE_CACHE_MISSES = 28,            //!< returns the number of software cache lookups that had to build new data (read only)
+  RTC_SOFTWARE_CACHE_FLUSHES = 29,           //!< returns the number of software cache segment flushes (read only)
+  RTC_SOFTWARE_CACHE_CONTENTION = 30,        //!< returns how often threads had to wait for another thread or a flush inside the software cache (read only)
+  RTC_SOFTWARE_CACHE_RESET_STATISTICS = 31,  //!< resets the software cache statistics, the value passed is ignored (write only)
+
+  RTC_TASKING_IDLE_SPIN_ROUNDS = 32,         //!< number of spinning rounds idle worker threads try to steal work before backing off, default 32 (read/write, internal tasking system only)
+  RTC_TASKING_IDLE_BACKOFF_ROUNDS = 33,      //!< number of sleeping rounds with exponential backoff (1us to 1ms) after spinning, default 0 (read/write, internal tasking system only)
+  RTC_TASKING_IDLE_PARKING = 34,             //!< if enabled, idle worker threads park until new tasks get spawned after spinning and backoff, default 0 (read/write, internal tasking system only)
+  RTC_TASKING_IDLE_PARK_COUNT = 35,          //!< returns how often idle worker threads got parked (read only)
+
+  RTC_MEMORY_RECYCLE_MAX_BYTES = 36,         //!< maximal number of bytes of released build memory that stays mapped for later builds, default 0 (read/write)
+  RTC_MEMORY_RECYCLED_BYTES = 37,            //!< returns the number of bytes of build memory that currently stays mapped (read only)
+  RTC_MEMORY_RECYCLE_COUNT = 38,             //!< returns how many memory blocks got reused from the mapped build memory (read only)
+  RTC_HUGE_PAGE_MODE = 39,                   //!< huge page mode for large OS allocations: 0 = never, 1 = madvise, 2 = explicit 2MB pages (default), 3 = explicit 1GB pages (read/write)
+  RTC_HUGE_PAGE_MIN_BYTES_ACCEL = 40,        //!< minimal size of acceleration structure memory blocks to use huge pages, default 2MB (read/write)
+  RTC_HUGE_PAGE_MIN_BYTES_BUILD = 41,        //!< minimal size of temporary build arrays to get allocated directly from the OS using huge pages, 0 disables this (read/write)
+  RTC_HUGE_PAGE_BYTES = 42,                  //!< returns the number of bytes currently mapped from the explicit huge page pool (read only)
+  RTC_HUGE_PAGE_ADVISED_BYTES = 43,          //!< returns the number of bytes currently advised to use transparent huge pages (read only)
+
+  RTC_CONFIG_POINT_GEOMETRY = 44,            //!< checks if point geometries are supported
 };
 
 /*! \brief Configures some parameters. 
@@ -109,6 +109,95 @@ RTCORE_API void* rtcBuildBVH(RTCBVH bvh,                                     //!
                              void* userPtr                                   //!< user pointer passed to callback functions
   ); 
 
+/*! Input primitives for the motion blur builder. Stores the bounds
+ *  of the primitive at time 0 and time 1 and its ID. The bounds at
+ *  intermediate times are linearly interpolated. */
+struct RTCORE_ALIGN(32) RTCBuildPrimitiveMB
+{
+  float lower0_x, lower0_y, lower0_z;  //!< lower bounds in x/y/z at time 0
+  int geomID;                          //!< first ID
+  float upper0_x, upper0_y, upper0_z;  //!< upper bounds in x/y/z at time 0
+  int primID;                          //!< second ID
+  float lower1_x, lower1_y, lower1_z;  //!< lower bounds in x/y/z at time 1
+  int align0;
+  float upper1_x, upper1_y, upper1_z;  //!< upper bounds in x/y/z at time 1
+  int align1;
+};
+
+/*! Callback to set the linear bounds of all children. The bounds of
+ *  child i at time t are the interpolation of bounds0[i] and
+ *  bounds1[i] with factor t. */
+typedef void  (*RTCSetNodeBoundsMBFunc) (void* nodePtr, const RTCBounds** bounds0, const RTCBounds** bounds1, size_t numChildren, void* userPtr);
+
+/*! Callback to create a leaf node of a motion blur BVH. */
+typedef void* (*RTCCreateLeafMBFunc) (RTCThreadLocalAllocator allocator, const RTCBuildPrimitiveMB* prims, size_t numPrims, void* userPtr);
+
+/*! Builds a BVH over motion blurred primitives, that stores linear
+ *  bounds in its nodes. The primitive array gets reordered such that
+ *  the primitives of each leaf are stored consecutively. */
+RTCORE_API void* rtcBuildBVHMB(RTCBVH bvh,                                  //!< BVH to build
+                               const RTCBuildSettings& settings,            //!< settings for BVH builder
+                               RTCBuildPrimitiveMB* primitives,             //!< list of input primitives, gets reordered
+                               size_t numPrimitives,                        //!< number of input primitives
+                               RTCCreateNodeFunc createNode,                //!< creates a node
+                               RTCSetNodeChildrenFunc setNodeChildren,      //!< sets pointer to all children
+                               RTCSetNodeBoundsMBFunc setNodeBounds,        //!< sets linear bounds of all children
+                               RTCCreateLeafMBFunc createLeaf,              //!< creates a leaf
+                               RTCBuildProgressFunc buildProgress,          //!< used to report build progress
+                               void* userPtr                                //!< user pointer passed to callback functions
+  );
+
+/*! Flags of child references of flat BVHs. */
+enum RTCFlatBVHFlags
+{
+  RTC_FLAT_BVH_LEAF  = 0x80000000,   //!< set for references to leaves, the lower bits store the leaf index
+  RTC_FLAT_BVH_EMPTY = 0xFFFFFFFF    //!< marks unused child slots of inner nodes
+};
+
+/*! BVH topology stored in flat arrays. Inner node i has its children
+ *  and child bounds stored at slots i*branchingFactor to
+ *  (i+1)*branchingFactor-1 of the children and bounds arrays. The
+ *  bounds are stored in SOA layout. Leaf j references the primitives
+ *  leafBegin[j] to leafBegin[j]+leafSize[j]-1 of the primitive array
+ *  passed to the builder, which got reordered by the build. */
+struct RTCFlatBVH
+{
+  unsigned root;              //!< reference to the root node
+  size_t branchingFactor;     //!< number of child slots of each inner node
+  size_t numNodes;            //!< number of inner nodes
+  size_t numLeaves;           //!< number of leaves
+  const unsigned* children;   //!< references to the children of all inner nodes
+  const float* lower_x;       //!< lower x bounds of all children
+  const float* lower_y;       //!< lower y bounds of all children
+  const float* lower_z;       //!< lower z bounds of all children
+  const float* upper_x;       //!< upper x bounds of all children
+  const float* upper_y;       //!< upper y bounds of all children
+  const float* upper_z;       //!< upper z bounds of all children
+  const unsigned* leafBegin;  //!< first primitive of each leaf
+  const unsigned* leafSize;   //!< number of primitives of each leaf
+};
+
+/*! Builds the BVH into flat arrays without invoking any node or leaf
+ *  callbacks. The arrays are owned by the BVH and stay valid until
+ *  the next build or the deletion of the BVH. */
+RTCORE_API void rtcBuildBVHFlat(RTCBVH bvh,                                 //!< BVH to build
+                                const RTCBuildSettings& settings,           //!< settings for BVH builder
+                                RTCBuildPrimitive* primitives,              //!< list of input primitives, gets reordered
+                                size_t numPrimitives,                       //!< number of input primitives
+                                RTCSplitPrimitiveFunc splitPrimitive,       //!< splits a primitive
+                                RTCBuildProgressFunc buildProgress,         //!< used to report build progress
+                                void* userPtr,                              //!< user pointer passed to callback functions
+                                RTCFlatBVH& flat_o                          //!< returns the flat BVH
+  );
+
+/*! Recomputes the child bounds of a BVH built with rtcBuildBVHFlat
+ *  (without spatial splits) bottom up, after the bounds of its
+ *  primitives changed. The primitive array has to be the array
+ *  reordered by the build with updated bounds. The topology of the
+ *  BVH stays unchanged, thus traversal performance degrades if
+ *  primitives move a lot relative to each other. */
+RTCORE_API void rtcRefitBVH(RTCBVH bvh, const RTCBuildPrimitive* primitives, size_t numPrimitives);
+
 /*! Allocates memory using the thread local allocator. Use this function to allocate nodes in the callback functions. */
 RTCORE_API void* rtcThreadLocalAlloc(RTCThreadLocalAllocator allocator, size_t bytes, size_t align);
 
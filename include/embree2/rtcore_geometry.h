@@ -57,6 +57,10 @@ enum RTCBufferType
   RTC_VERTEX_CREASE_WEIGHT_BUFFER = 0x08000000,
 
   RTC_HOLE_BUFFER          = 0x09000001,
+
+  RTC_NORMAL_BUFFER        = 0x0A000000,
+  RTC_NORMAL_BUFFER0       = 0x0A000000,
+  RTC_NORMAL_BUFFER1       = 0x0A000001,
 };
 
 /*! \brief Supported types of matrix layout for functions involving matrices */
@@ -492,11 +496,85 @@ RTCORE_API unsigned rtcNewLineSegments (RTCScene scene,                    //!<
                                         size_t numTimeSteps = 1            //!< number of motion blur time steps
   );
 
+/*! \brief Creates a new round line segment geometry, consisting of
+  multiple segments with varying radii. The layout of the index and
+  vertex buffers is the same as for rtcNewLineSegments. Different to
+  these line segments, each segment is intersected as a cone capped
+  by a sphere at each end point, which makes connected segments
+  render as closed tubes without gaps, also when zooming onto
+  them. The u coordinate of a hit is the parametric location along
+  the segment and Ng the surface normal. */
+RTCORE_API unsigned rtcNewRoundLineSegments (RTCScene scene,                    //!< the scene the line segments belong to
+                                             RTCGeometryFlags flags,            //!< geometry flags
+                                             size_t numSegments,                //!< number of line segments
+                                             size_t numVertices,                //!< number of vertices
+                                             size_t numTimeSteps = 1            //!< number of motion blur time steps
+  );
+
+/*! \brief Creates a new point geometry, consisting of multiple
+  spheres with varying radii. The number of points (numPoints) and
+  number of time steps have to get specified at construction time (1
+  for normal meshes, and up to RTC_MAX_TIME_STEPS for multi-segment
+  motion blur). Further, the point vertex buffer (RTC_VERTEX_BUFFER)
+  has to get set by mapping and writing to the appropiate buffer. In
+  case of multi-segment motion blur, multiple vertex buffers have to
+  get filled (RTC_VERTEX_BUFFER0, RTC_VERTEX_BUFFER1, etc.), one for
+  each time step. Each point consists of a single precision (x,y,z)
+  center and radius, stored in that order in memory. The primID of a
+  hit is the index of the point. */
+RTCORE_API unsigned rtcNewSpherePoints (RTCScene scene,                    //!< the scene the points belong to
+                                        RTCGeometryFlags flags,            //!< geometry flags
+                                        size_t numPoints,                  //!< number of points
+                                        size_t numTimeSteps = 1            //!< number of motion blur time steps
+  );
+
+/*! \brief Creates a new point geometry, consisting of multiple discs
+  that always face the ray. The layout of the vertex buffer is the
+  same as for rtcNewSpherePoints, the radius is the radius of the
+  disc. */
+RTCORE_API unsigned rtcNewDiscPoints (RTCScene scene,                    //!< the scene the points belong to
+                                      RTCGeometryFlags flags,            //!< geometry flags
+                                      size_t numPoints,                  //!< number of points
+                                      size_t numTimeSteps = 1            //!< number of motion blur time steps
+  );
+
+/*! \brief Creates a new point geometry, consisting of multiple discs
+  with a user specified orientation. The layout of the vertex buffer
+  is the same as for rtcNewSpherePoints. Additionally the normal
+  buffer (RTC_NORMAL_BUFFER) has to get set, which stores one single
+  precision (x,y,z) normal per point, with the same stride rules as
+  the vertex buffer. In case of multi-segment motion blur, one normal
+  buffer has to get filled per time step (RTC_NORMAL_BUFFER0,
+  RTC_NORMAL_BUFFER1, etc.). */
+RTCORE_API unsigned rtcNewOrientedDiscPoints (RTCScene scene,                    //!< the scene the points belong to
+                                              RTCGeometryFlags flags,            //!< geometry flags
+                                              size_t numPoints,                  //!< number of points
+                                              size_t numTimeSteps = 1            //!< number of motion blur time steps
+  );
+
 /*! Sets a uniform tessellation rate for subdiv meshes and hair
  *  geometry. For subdivision meshes the RTC_LEVEL_BUFFER can also be used
  *  optionally to set a different tessellation rate per edge.*/
 RTCORE_API void rtcSetTessellationRate (RTCScene scene, unsigned geomID, float tessellationRate);
 
+/*! \brief Camera description used to calculate view dependent tessellation levels. */
+struct RTCTessellationCamera
+{
+  float position[3];  //!< camera position in world space
+  float pixelScale;   //!< image height in pixels divided by 2*tan(fovy/2)
+  float edgeLength;   //!< desired length of a tessellated edge in pixels
+  float maxLevel;     //!< maximal tessellation level to use for an edge
+};
+
+/*! Enables view dependent tessellation levels for subdiv
+ *  meshes. Embree calculates the level of each edge at commit time
+ *  such that the tessellated edge has the specified length in pixels
+ *  when seen from the camera position. Levels of shared edges are
+ *  always identical. Passing NULL disables view dependent
+ *  tessellation. The view dependent levels have preference over the
+ *  RTC_LEVEL_BUFFER and the uniform tessellation rate. */
+RTCORE_API void rtcSetTessellationCamera (RTCScene scene, unsigned geomID, const RTCTessellationCamera* camera);
+
 /*! \brief Sets 32 bit ray mask. */
 RTCORE_API void rtcSetMask (RTCScene scene, unsigned geomID, int mask);
 
@@ -114,6 +114,26 @@ typedef void (*RTCOccludedFuncN) (const int* valid,                      /*! poi
                                   size_t N,                              /*!< number of rays in packet */
                                   size_t item                            /*!< item to test for occlusion */);
 
+/*! Type of intersect function pointer for ray packets of size N
+ *  intersected with M items stored in the same BVH leaf. */
+typedef void (*RTCIntersectFuncNM)(const int* valid,                        /*!< pointer to valid mask */
+                                   void* ptr,                               /*!< pointer to geometry user data */
+                                   const RTCIntersectContext* context,      /*!< intersection context as passed to rtcIntersect/rtcOccluded */
+                                   RTCRayN* rays,                           /*!< ray packet to intersect */
+                                   size_t N,                                /*!< number of rays in packet */
+                                   const unsigned* items,                   /*!< items to intersect */
+                                   size_t M                                 /*!< number of items */);
+
+/*! Type of occlusion function pointer for ray packets of size N
+ *  tested against M items stored in the same BVH leaf. */
+typedef void (*RTCOccludedFuncNM) (const int* valid,                        /*!< pointer to valid mask */
+                                   void* ptr,                               /*!< pointer to geometry user data */
+                                   const RTCIntersectContext* context,      /*!< intersection context as passed to rtcIntersect/rtcOccluded */
+                                   RTCRayN* rays,                           /*!< ray packet to test occlusion for */
+                                   size_t N,                                /*!< number of rays in packet */
+                                   const unsigned* items,                   /*!< items to test for occlusion */
+                                   size_t M                                 /*!< number of items */);
+
 /*! Creates a new user geometry object. This feature makes it possible
  *  to add arbitrary types of geometry to the scene by providing
  *  appropiate bounding, intersect and occluded functions. A user
@@ -187,6 +207,12 @@ RTCORE_API void rtcSetIntersectFunction1Mp (RTCScene scene, unsigned geomID, RTC
  *  geometry. */
 RTCORE_API void rtcSetIntersectFunctionN (RTCScene scene, unsigned geomID, RTCIntersectFuncN intersect);
 
+/*! Set intersect function for ray packets of size N and M items. The
+ *  function gets called for all items of a BVH leaf at once and is
+ *  used instead of all other intersect functions of the user
+ *  geometry. In stream mode and for single items M is 1. */
+RTCORE_API void rtcSetIntersectFunctionNM (RTCScene scene, unsigned geomID, RTCIntersectFuncNM intersect);
+
 /*! Set occlusion function for single rays. The rtcOccluded function
  *  will call the passed function for intersecting the user
  *  geometry. */
@@ -217,6 +243,12 @@ RTCORE_API void rtcSetOccludedFunction1Mp (RTCScene scene, unsigned geomID, RTCO
  *  geometry. */
 RTCORE_API void rtcSetOccludedFunctionN (RTCScene scene, unsigned geomID, RTCOccludedFuncN occluded);
 
+/*! Set occlusion function for ray packets of size N and M items. The
+ *  function gets called for all items of a BVH leaf at once and is
+ *  used instead of all other occlusion functions of the user
+ *  geometry. In stream mode and for single items M is 1. */
+RTCORE_API void rtcSetOccludedFunctionNM (RTCScene scene, unsigned geomID, RTCOccludedFuncNM occluded);
+
 
 /*! @} */
 
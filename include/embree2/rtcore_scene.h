@@ -92,6 +92,56 @@ RTCORE_API void rtcSetProgressMonitorFunction(RTCScene scene, RTCProgressMonitor
  *  rays. */
 RTCORE_API void rtcCommit (RTCScene scene);
 
+/*! Priority classes for scene commits. */
+enum RTCCommitPriority
+{
+  RTC_COMMIT_PRIORITY_LOW = 0,     //!< background builds that may get delayed by other commits
+  RTC_COMMIT_PRIORITY_NORMAL = 1,  //!< default priority of rtcCommit
+  RTC_COMMIT_PRIORITY_HIGH = 2     //!< interactive builds that should finish as fast as possible
+};
+
+/*! Commits the geometry of the scene with some priority. Worker
+ *  threads that build scenes of lower priority help building scenes
+ *  of higher priority as soon as they finish their current task. When
+ *  Embree is using TBB the priority is mapped to the priority of the
+ *  TBB task group context of the build. */
+RTCORE_API void rtcCommitWithPriority (RTCScene scene, RTCCommitPriority priority);
+
+/*! Commits the geometry of the scene in time slices. The function
+ *  returns true when the build finished, or false when the build
+ *  got interrupted after roughly the specified number of
+ *  milliseconds. In the latter case the scene cannot get used for
+ *  ray queries and the function has to get called again to continue
+ *  the build. Per object hierarchies of dynamic scenes that got
+ *  finished in previous time slices are reused, all other parts of
+ *  the build restart. To guarantee progress, the time slice doubles
+ *  with each interrupted call until the build finishes. */
+RTCORE_API bool rtcCommitTimeSliced (RTCScene scene, unsigned int milliseconds);
+
+/*! Cancels the running commit of the scene, or the next commit if
+ *  no commit is running. The cancelled commit returns with an
+ *  RTC_CANCELLED error and the scene has to get committed again
+ *  before it can get used for ray queries. This function can get
+ *  called from any thread. */
+RTCORE_API void rtcCancelCommit (RTCScene scene);
+
+/*! Commits the geometry of the scene asynchronously. A new
+ *  generation of the acceleration structures gets built in the
+ *  background, while ray queries continue to use the previously
+ *  committed generation. The scene must not get modified until
+ *  rtcCommitAsyncFinish returned true. Static scenes and scenes
+ *  containing curves or subdivision meshes cannot get committed
+ *  asynchronously. */
+RTCORE_API void rtcCommitAsync (RTCScene scene);
+
+/*! Makes the generation built by rtcCommitAsync current. Returns
+ *  false if the build did not finish yet (only if wait is false), the
+ *  previous generation stays in use in that case. This function has
+ *  to get called while no ray queries are running on the scene, the
+ *  previous generation gets reused for the next asynchronous
+ *  commit. */
+RTCORE_API bool rtcCommitAsyncFinish (RTCScene scene, bool wait);
+
 /*! Commits the geometry of the scene in join mode. When Embree is
  *  using TBB (default), threads that call `rtcCommitJoin` will
  *  participate in the hierarchy build procedure. When Embree is using
@@ -121,6 +171,27 @@ RTCORE_API void rtcGetBounds(RTCScene scene, RTCBounds& bounds_o);
  *  previously to this function. */
 RTCORE_API void rtcGetLinearBounds(RTCScene scene, RTCBounds* bounds_o);
 
+/*! memory usage of one acceleration structure of a scene */
+struct RTCAccelMemoryStatistics
+{
+  const char* name;              //!< name of the acceleration structure, e.g. "BVH4<triangle4>"
+  size_t numPrimitives;          //!< number of primitives the acceleration structure got built over
+  size_t bytesNodes;             //!< bytes of all inner nodes
+  size_t bytesLeaves;            //!< bytes of all leaves
+  size_t bytesPrimRefs;          //!< bytes of temporary build arrays kept for later builds
+  size_t bytesWasted;            //!< bytes of allocated memory blocks not occupied by nodes or leaves
+  size_t bytesTessellationCache; //!< bytes occupied in the tessellation cache shared by all scenes
+};
+
+/*! Returns the number of acceleration structures of the scene and
+ *  writes the memory statistics of at most maxCount of them to
+ *  stats. The statistics get gathered by traversing the acceleration
+ *  structures, thus this function should not get called every
+ *  frame. The name pointers stay valid until the scene gets
+ *  deleted. rtcCommit has to get called previously to this
+ *  function. */
+RTCORE_API size_t rtcGetMemoryStatistics(RTCScene scene, RTCAccelMemoryStatistics* stats, size_t maxCount);
+
 /*! Intersects a single ray with the scene. The ray has to be aligned
  *  to 16 bytes. This function can only be called for scenes with the
  *  RTC_INTERSECT1 flag set. */
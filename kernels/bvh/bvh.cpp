@@ -22,7 +22,7 @@ namespace embree
   template<int N>
   BVHN<N>::BVHN (const PrimitiveType& primTy, Scene* scene)
     : AccelData((N==4) ? AccelData::TY_BVH4 : (N==8) ? AccelData::TY_BVH8 : AccelData::TY_UNKNOWN),
-      primTy(primTy), device(scene->device), scene(scene),
+      primTy(primTy), name("BVH"+toString(N)+"<"+primTy.name+">"), device(scene->device), scene(scene),
       root(emptyNode), msmblur(false), numTimeSteps(1), alloc(scene->device,scene->isStatic()), numPrimitives(0), numVertices(0) , primrefs(scene->device)
   {
   }
@@ -55,6 +55,32 @@ namespace embree
     std::cout << BVHNStatistics<N>(this).str();
   }	
 
+  template<int N>
+  void BVHN<N>::getMemoryStatistics(std::vector<RTCAccelMemoryStatistics>& stats)
+  {
+    RTCAccelMemoryStatistics s;
+    s.name = name.c_str();
+    s.numPrimitives = numPrimitives;
+    s.bytesNodes = 0;
+    s.bytesLeaves = subdiv_patches.size();
+    if (root != emptyNode) {
+      BVHNStatistics<N> stat(this);
+      s.bytesNodes  += stat.bytesNodes();
+      s.bytesLeaves += stat.bytesLeaves();
+    }
+    s.bytesPrimRefs = primrefs.capacity()*sizeof(PrimRef);
+
+    /* the nodes and leaves of the object BVHs of two-level BVHs get counted for the top-level BVH */
+    size_t bytesAllocated = alloc.getAllocatedBytes() + subdiv_patches.size();
+    for (size_t i=0; i<objects.size(); i++) 
+      if (objects[i]) bytesAllocated += objects[i]->alloc.getAllocatedBytes() + objects[i]->subdiv_patches.size();
+    s.bytesWasted = max(bytesAllocated,s.bytesNodes+s.bytesLeaves)-(s.bytesNodes+s.bytesLeaves);
+
+    /* the tessellation cache is shared by all scenes */
+    s.bytesTessellationCache = primTy.name == "subdivpatch1cached" ? device->getParameter1i(RTC_SOFTWARE_CACHE_USED_BYTES) : 0;
+    stats.push_back(s);
+  }
+
   template<int N>
   void BVHN<N>::clearBarrier(NodeRef& node)
   {
@@ -1169,6 +1169,9 @@ namespace embree
     /*! prints statistics about the BVH */
     void printStatistics();
 
+    /*! appends memory statistics of the BVH */
+    void getMemoryStatistics(std::vector<RTCAccelMemoryStatistics>& stats);
+
     /*! Clears the barrier bits of a subtree. */
     void clearBarrier(NodeRef& node);
 
@@ -1286,6 +1289,7 @@ namespace embree
     /*! bvh type information */
   public:
     const PrimitiveType& primTy;       //!< primitive type stored in the BVH
+    const std::string name;            //!< name of the BVH, e.g. BVH4<triangle4>
 
     /*! bvh data */
   public:
@@ -20,6 +20,7 @@
 
 #include "../geometry/bezier1v.h"
 #include "../geometry/bezier1i.h"
+#include "../geometry/bezier8q.h"
 
 #if defined(EMBREE_GEOMETRY_HAIR)
 
@@ -60,22 +61,22 @@ namespace embree
 
         /* estimate acceleration structure size */
         const size_t node_bytes = pinfo.size()*sizeof(typename BVH::UnalignedNode)/(4*N);
-        const size_t leaf_bytes = pinfo.size()*sizeof(Primitive);
+        const size_t leaf_bytes = Primitive::blocks(pinfo.size())*sizeof(Primitive);
         bvh->alloc.init_estimate(node_bytes+leaf_bytes);
         
-        /* builder settings */
+        /* builder settings, blocked primitives are filled with up to max_size() curves */
         BVHNBuilderHair::Settings settings;
         settings.branchingFactor = N;
         settings.maxDepth = BVH::maxBuildDepthLeaf;
-        settings.logBlockSize = 0;
-        settings.minLeafSize = 1;
-        settings.maxLeafSize = BVH::maxLeafBlocks;
+        settings.logBlockSize = __bsr(Primitive::max_size());
+        settings.minLeafSize = Primitive::max_size();
+        settings.maxLeafSize = Primitive::max_size()*BVH::maxLeafBlocks;
 
         /* creates a leaf node */
         auto createLeaf = [&] (size_t depth, const range<size_t>& set, FastAllocator::ThreadLocal2* alloc) -> NodeRef
           {
             size_t start = set.begin();
-            size_t items = set.size();
+            size_t items = Primitive::blocks(set.size());
             Primitive* accel = (Primitive*) alloc->alloc1->malloc(items*sizeof(Primitive),BVH::byteAlignment);
             for (size_t i=0; i<items; i++) {
               accel[i].fill(prims.data(),start,set.end(),bvh->scene);
@@ -83,16 +84,24 @@ namespace embree
             return bvh->encodeLeaf((char*)accel,items);
           };
           
+        /* sets aligned and unaligned node bounds, enlarged by the quantization error of quantized leaves */
+        auto setAlignedNode = [&] (NodeRef node, size_t i, NodeRef child, const BBox3fa& bounds) {
+          typename BVH::AlignedNode::Set()(node,i,child,enlargeByQuantizationError(bounds));
+        };
+        auto setUnalignedNode = [&] (NodeRef node, size_t i, NodeRef child, const OBBox3fa& bounds) {
+          typename BVH::UnalignedNode::Set()(node,i,child,OBBox3fa(bounds.space,enlargeByQuantizationError(bounds.bounds)));
+        };
+
         /* build hierarchy */
         typename BVH::NodeRef root = BVHNBuilderHair::build<NodeRef>
           (typename BVH::CreateAlloc(bvh),
            typename BVH::AlignedNode::Create(),
-           typename BVH::AlignedNode::Set(),
+           setAlignedNode,
            typename BVH::UnalignedNode::Create(),
-           typename BVH::UnalignedNode::Set(),
+           setUnalignedNode,
            createLeaf,scene->progressInterface,scene,prims.data(),pinfo,settings);
         
-        bvh->set(root,LBBox3fa(pinfo.geomBounds),pinfo.size());
+        bvh->set(root,LBBox3fa(enlargeByQuantizationError(pinfo.geomBounds)),pinfo.size());
         
         //});
         
@@ -108,6 +117,18 @@ namespace embree
       void clear() {
         prims.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims.capacity()*sizeof(prims[0]);
+      }
+
+      /*! quantized curves can extend a bit beyond the bounds of the original curves */
+      static __forceinline BBox3fa enlargeByQuantizationError(const BBox3fa& bounds)
+      {
+        if (!std::is_same<Primitive,Bezier8q>::value) return bounds;
+        const Vec3fa eps(Bezier8q::quantizationError(bounds));
+        return BBox3fa(bounds.lower-eps,bounds.upper+eps);
+      }
     };
 
 
@@ -237,6 +258,10 @@ namespace embree
       void clear() {
         prims.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims.capacity()*sizeof(prims[0]);
+      }
     };
     
     /*! entry functions for the builder */
@@ -247,6 +272,7 @@ namespace embree
 #if defined(__AVX__)
     Builder* BVH8Bezier1vBuilder_OBB_New   (void* bvh, Scene* scene, size_t mode) { return new BVHNHairBuilderSAH<8,Bezier1v>((BVH8*)bvh,scene); }
     Builder* BVH8Bezier1iBuilder_OBB_New   (void* bvh, Scene* scene, size_t mode) { return new BVHNHairBuilderSAH<8,Bezier1i>((BVH8*)bvh,scene); }
+    Builder* BVH8Bezier8qBuilder_OBB_New   (void* bvh, Scene* scene, size_t mode) { return new BVHNHairBuilderSAH<8,Bezier8q>((BVH8*)bvh,scene); }
     Builder* BVH8Bezier1iMBBuilder_OBB_New (void* bvh, Scene* scene, size_t mode) { return new BVHNHairMBBuilderSAH<8,Bezier1i>((BVH8*)bvh,scene); }
 #endif
 
@@ -124,6 +124,7 @@ namespace embree
       /* resize object array if scene got larger */
       if (objects.size()  < num) objects.resize(num);
       if (builders.size() < num) builders.resize(num);
+      if (builtModCounters.size() < num) builtModCounters.resize(num,size_t(-1));
       if (refs.size()     < num) refs.resize(num);
       nextRef.store(0);
       
@@ -141,8 +142,10 @@ namespace embree
             }
             
             /* create BVH and builder for new meshes */
-            if (objects[objectID] == nullptr) 
+            if (objects[objectID] == nullptr) {
               createMeshAccel(mesh,(AccelData*&)objects[objectID],builders[objectID]);
+              builtModCounters[objectID] = size_t(-1);
+            }
           }
         });
       
@@ -154,8 +157,10 @@ namespace embree
             if (geom == nullptr) continue;
             Builder* builder = builders[objectID]; 
             if (builder == nullptr) continue;
-            if (geom->isModified() && geom->isInstanced()) 
+            if (builtModCounters[objectID] != geom->getModCounter() && geom->isInstanced()) {
               builder->build();
+              builtModCounters[objectID] = geom->getModCounter();
+            }
           }
         });
 
@@ -295,9 +300,21 @@ namespace embree
       
       for (size_t i=0; i<builders.size(); i++) 
 	if (builders[i]) builders[i]->clear();
+
+      for (size_t i=0; i<builtModCounters.size(); i++) 
+        builtModCounters[i] = size_t(-1);
       
       refs.clear();
     }
+
+    template<int N, typename Mesh>
+    size_t BVHNBuilderInstancing<N,Mesh>::bytesTemporary() const
+    {
+      size_t bytes = refs.capacity()*sizeof(BuildRef) + prims.capacity()*sizeof(PrimRef);
+      for (size_t i=0; i<builders.size(); i++) 
+        if (builders[i]) bytes += builders[i]->bytesTemporary();
+      return bytes;
+    }
     
     template<int N, typename Mesh>
     void BVHNBuilderInstancing<N,Mesh>::open(size_t numInstancedPrimitives)
@@ -89,6 +89,7 @@ namespace embree
       void build();
       void deleteGeometry(size_t geomID);
       void clear();
+      size_t bytesTemporary() const;
 
       void open(size_t numPrimitives);
 
@@ -99,6 +100,7 @@ namespace embree
       BVH* bvh;
       std::vector<BVH*>& objects;
       std::vector<Builder*> builders;
+      std::vector<size_t> builtModCounters; //!< modification counter of each mesh at its last object build, -1 if invalid
       const createMeshAccelTy createMeshAccel;
 
     public:
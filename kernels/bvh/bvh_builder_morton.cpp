@@ -444,6 +444,10 @@ namespace embree
       void clear() {
         morton.clear();
       }
+
+      size_t bytesTemporary() const {
+        return morton.capacity()*sizeof(morton[0]);
+      }
       
     private:
       BVH* bvh;
@@ -22,7 +22,9 @@
 
 #include "../geometry/bezier1v.h"
 #include "../geometry/bezier1i.h"
+#include "../geometry/bezier1s.h"
 #include "../geometry/linei.h"
+#include "../geometry/pointi.h"
 #include "../geometry/triangle.h"
 #include "../geometry/trianglev.h"
 #include "../geometry/trianglei.h"
@@ -191,6 +193,10 @@ namespace embree
       void clear() {
         prims.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims.capacity()*sizeof(prims[0]);
+      }
     };
 
     /************************************************************************************/ 
@@ -267,6 +273,10 @@ namespace embree
       void clear() {
         prims.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims.capacity()*sizeof(prims[0]);
+      }
     };
 
     /************************************************************************************/ 
@@ -369,6 +379,10 @@ namespace embree
       void clear() {
         prims.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims.capacity()*sizeof(prims[0]);
+      }
     };
 
     /************************************************************************************/ 
@@ -457,6 +471,10 @@ namespace embree
       void clear() {
         prims0.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims0.capacity()*sizeof(prims0[0]);
+      }
     };
 
     /************************************************************************************/ 
@@ -475,9 +493,19 @@ namespace embree
 #endif
 #endif
 
+#if defined(EMBREE_GEOMETRY_POINTS)
+    Builder* BVH4Point4iSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,Points,Point4i>((BVH4*)bvh,scene,4,1.0f,4,inf,mode,HIGH_SINGLE_THREAD_THRESHOLD); }
+    Builder* BVH4Point4iMBSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderMSMBlurSAH<4,Points,Point4i>((BVH4*)bvh,scene,4,1.0f,4,inf,HIGH_SINGLE_THREAD_THRESHOLD); }
+#if defined(__AVX__)
+    Builder* BVH8Point4iSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<8,Points,Point4i>((BVH8*)bvh,scene,4,1.0f,4,inf,mode,HIGH_SINGLE_THREAD_THRESHOLD); }
+    Builder* BVH8Point4iMBSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderMSMBlurSAH<8,Points,Point4i>((BVH8*)bvh,scene,4,1.0f,4,inf,HIGH_SINGLE_THREAD_THRESHOLD); }
+#endif
+#endif
+
 #if defined(EMBREE_GEOMETRY_HAIR)
     Builder* BVH4Bezier1vSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,NativeCurves,Bezier1v>((BVH4*)bvh,scene,1,1.0f,1,inf,mode,HIGH_SINGLE_THREAD_THRESHOLD); }
     Builder* BVH4Bezier1iSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,NativeCurves,Bezier1i>((BVH4*)bvh,scene,1,1.0f,1,inf,mode,HIGH_SINGLE_THREAD_THRESHOLD); }
+    Builder* BVH4Bezier1sSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,NativeCurves,Bezier1s>((BVH4*)bvh,scene,1,1.0f,1,inf,mode,HIGH_SINGLE_THREAD_THRESHOLD); }
 #endif
 
 #if defined(EMBREE_GEOMETRY_TRIANGLES)
@@ -57,9 +57,10 @@ namespace embree
 
 #define SUBGRID 9
 
+      /* subgrids share their border vertices, thus each additional subgrid covers SUBGRID-1 vertices */
       static unsigned getNumEagerLeaves(unsigned width, unsigned height) {
-        const unsigned w = (width+SUBGRID-1)/SUBGRID;
-        const unsigned h = (width+SUBGRID-1)/SUBGRID;
+        const unsigned w = (width -1+SUBGRID-2)/(SUBGRID-1);
+        const unsigned h = (height-1+SUBGRID-2)/(SUBGRID-1);
         return w*h;
       }
 
@@ -68,15 +69,33 @@ namespace embree
         unsigned NN = 0;
         const unsigned x0 = 0, x1 = patch.grid_u_res-1;
         const unsigned y0 = 0, y1 = patch.grid_v_res-1;
+        const unsigned width = x1-x0+1;
+
+        /* temporary storage for one row of subgrids, evalGrid writes with SIMD granularity */
+        const unsigned temp_size = width*SUBGRID+VSIZEX;
+        dynamic_large_stack_array(float,grid_x ,temp_size,64*SUBGRID*sizeof(float));
+        dynamic_large_stack_array(float,grid_y ,temp_size,64*SUBGRID*sizeof(float));
+        dynamic_large_stack_array(float,grid_z ,temp_size,64*SUBGRID*sizeof(float));
+        dynamic_large_stack_array(float,grid_u ,temp_size,64*SUBGRID*sizeof(float));
+        dynamic_large_stack_array(float,grid_v ,temp_size,64*SUBGRID*sizeof(float));
+        dynamic_large_stack_array(float,grid_uv,temp_size,64*SUBGRID*sizeof(float));
         
         for (unsigned y=y0; y<y1; y+=SUBGRID-1)
         {
+          const unsigned ly0 = y, ly1 = min(ly0+SUBGRID-1,y1);
+
+          /* evaluate the patch once for the entire row of subgrids, this avoids
+             setting up the patch evaluation and calling the displacement shader
+             for each subgrid individually */
+          evalGrid(patch,x0,x1,ly0,ly1,patch.grid_u_res,patch.grid_v_res,grid_x,grid_y,grid_z,grid_u,grid_v,mesh);
+          GridSOA::encodeUVs(grid_u,grid_v,grid_uv,width*(ly1-ly0+1));
+
+          /* stream the subgrids directly into the shared allocator */
           for (unsigned x=x0; x<x1; x+=SUBGRID-1) 
           {
             const unsigned lx0 = x, lx1 = min(lx0+SUBGRID-1,x1);
-            const unsigned ly0 = y, ly1 = min(ly0+SUBGRID-1,y1);
             BBox3fa bounds;
-            GridSOA* leaf = GridSOA::create(&patch,1,1,lx0,lx1,ly0,ly1,scene,alloc,&bounds);
+            GridSOA* leaf = GridSOA::create(&patch,lx1-lx0+1,ly1-ly0+1,&grid_x[lx0],&grid_y[lx0],&grid_z[lx0],&grid_uv[lx0],width,alloc,&bounds);
             *prims = PrimRef(bounds,BVH4::encodeTypedLeaf(leaf,1)); prims++;
             NN++;
           }
@@ -198,6 +217,10 @@ namespace embree
       void clear() {
         prims.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims.capacity()*sizeof(prims[0]);
+      }
     };
 
     // =======================================================================================================
@@ -554,6 +577,10 @@ namespace embree
       void clear() {
         prims.clear();
       }
+
+      size_t bytesTemporary() const {
+        return prims.capacity()*sizeof(prims[0]) + bounds.capacity()*sizeof(bounds[0]);
+      }
     };
     
     /* entry functions for the scene builder */
@@ -75,6 +75,7 @@ namespace embree
       /* resize object array if scene got larger */
       if (objects.size()  < num) objects.resize(num);
       if (builders.size() < num) builders.resize(num);
+      if (builtModCounters.size() < num) builtModCounters.resize(num,size_t(-1));
       if (refs.size()     < num) refs.resize(num);
       nextRef.store(0);
 
@@ -94,8 +95,10 @@ namespace embree
           }
           
           /* create BVH and builder for new meshes */
-          if (objects[objectID] == nullptr)
+          if (objects[objectID] == nullptr) {
             createMeshAccel(mesh,(AccelData*&)objects[objectID],builders[objectID]);
+            builtModCounters[objectID] = size_t(-1);
+          }
         }
       });
       /* parallel build of acceleration structures */
@@ -111,11 +114,17 @@ namespace embree
           BVH*     object  = objects [objectID]; assert(object);
           Builder* builder = builders[objectID]; assert(builder);
           
-          /* build object if it got modified */
+          /* build object if it got modified since its last build, this
+           * skips objects that got already built by a cancelled or
+           * interrupted commit and keeps both generations of
+           * asynchronous commits up to date */
 #if !PROFILE 
-          if (mesh->isModified()) 
+          if (builtModCounters[objectID] != mesh->getModCounter()) 
 #endif
+          {
             builder->build();
+            builtModCounters[objectID] = mesh->getModCounter();
+          }
           
           /* create build primitive */
           if (!object->getBounds().empty())
@@ -220,9 +229,21 @@ namespace embree
       for (size_t i=0; i<builders.size(); i++) 
 	if (builders[i]) builders[i]->clear();
 
+      for (size_t i=0; i<builtModCounters.size(); i++) 
+        builtModCounters[i] = size_t(-1);
+
       refs.clear();
     }
 
+    template<int N, typename Mesh>
+    size_t BVHNBuilderTwoLevel<N,Mesh>::bytesTemporary() const
+    {
+      size_t bytes = refs.capacity()*sizeof(BuildRef) + prims.capacity()*sizeof(PrimRef);
+      for (size_t i=0; i<builders.size(); i++) 
+        if (builders[i]) bytes += builders[i]->bytesTemporary();
+      return bytes;
+    }
+
     template<int N, typename Mesh>
     void BVHNBuilderTwoLevel<N,Mesh>::open_sequential(size_t numPrimitives)
     {
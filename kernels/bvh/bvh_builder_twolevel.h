@@ -74,6 +74,7 @@ namespace embree
       void build();
       void deleteGeometry(size_t geomID);
       void clear();
+      size_t bytesTemporary() const;
 
       void open_sequential(size_t numPrimitives);
       void open_overlap(size_t numPrimitives);
@@ -82,6 +83,7 @@ namespace embree
       BVH* bvh;
       std::vector<BVH*>& objects;
       std::vector<Builder*> builders;
+      std::vector<size_t> builtModCounters; //!< modification counter of each mesh at its last completed object build, -1 if invalid
       
     public:
       Scene* scene;
@@ -29,7 +29,9 @@
 #include "../geometry/quadi_mb_intersector.h"
 #include "../geometry/bezier1v_intersector.h"
 #include "../geometry/bezier1i_intersector.h"
+#include "../geometry/bezier1s_intersector.h"
 #include "../geometry/linei_intersector.h"
+#include "../geometry/pointi_intersector.h"
 #include "../geometry/subdivpatch1eager_intersector.h"
 #include "../geometry/subdivpatch1cached_intersector.h"
 #include "../geometry/object_intersector.h"
@@ -29,7 +29,9 @@
 #include "../geometry/quadi_mb_intersector.h"
 #include "../geometry/bezier1v_intersector.h"
 #include "../geometry/bezier1i_intersector.h"
+#include "../geometry/bezier1s_intersector.h"
 #include "../geometry/linei_intersector.h"
+#include "../geometry/pointi_intersector.h"
 #include "../geometry/subdivpatch1eager_intersector.h"
 #include "../geometry/subdivpatch1cached_intersector.h"
 #include "../geometry/object_intersector.h"
@@ -581,8 +583,8 @@ namespace embree
                                     TriangleMIntersectorKMoeller<4 COMMA VSIZEX COMMA VSIZEX COMMA false > > Triangle4IntersectorStreamMoellerNoFilter;
 
     typedef ArrayIntersectorKStream<VSIZEX,
-                                    TriangleMvIntersector1Pluecker<SIMD_MODE(4) COMMA true >,
-                                    TriangleMvIntersectorKPluecker<4 COMMA VSIZEX COMMA VSIZEX COMMA true > > Triangle4vIntersectorStreamPluecker;
+                                    TriangleMvIntersector1Woop<SIMD_MODE(4) COMMA true >,
+                                    TriangleMvIntersectorKWoop<4 COMMA VSIZEX COMMA VSIZEX COMMA true > > Triangle4vIntersectorStreamWoop;
 
     typedef ArrayIntersectorKStream<VSIZEX,
                                     TriangleMiIntersector1Moeller<SIMD_MODE(4) COMMA true >,
@@ -605,8 +607,8 @@ namespace embree
                                     QuadMiIntersectorKMoeller<4 COMMA VSIZEX COMMA true > > Quad4iIntersectorStreamMoeller;
     
     typedef ArrayIntersectorKStream<VSIZEX,
-                                    QuadMvIntersector1Pluecker<4 COMMA true >,
-                                    QuadMvIntersectorKPluecker<4 COMMA VSIZEX COMMA true > > Quad4vIntersectorStreamPluecker;
+                                    QuadMvIntersector1Woop<4 COMMA true >,
+                                    QuadMvIntersectorKWoop<4 COMMA VSIZEX COMMA true > > Quad4vIntersectorStreamWoop;
 
     typedef ArrayIntersectorKStream<VSIZEX,
                                     QuadMiIntersector1Pluecker<4 COMMA true >,
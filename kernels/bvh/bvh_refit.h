@@ -87,6 +87,10 @@ namespace embree
       
       virtual void clear();
 
+      virtual size_t bytesTemporary() const {
+        return builder ? builder->bytesTemporary() : 0;
+      }
+
       virtual const BBox3fa leafBounds (NodeRef& ref) const
       {
         size_t num; char* prim = ref.leaf(num);
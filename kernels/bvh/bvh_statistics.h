@@ -273,6 +273,14 @@ namespace embree
       return stat.bytes(bvh);
     }
 
+    size_t bytesLeaves() const {
+      return stat.statLeaf.bytes(bvh);
+    }
+
+    size_t bytesNodes() const {
+      return stat.bytes(bvh)-stat.statLeaf.bytes(bvh);
+    }
+
   private:
     Statistics statistics(NodeRef node, const double A, const BBox1f dt);
 
@@ -40,6 +40,9 @@ namespace embree
     /*! clears the acceleration structure data */
     virtual void clear() = 0;
 
+    /*! appends memory statistics of all contained acceleration structures */
+    virtual void getMemoryStatistics(std::vector<RTCAccelMemoryStatistics>& stats) {};
+
     /*! returns normal bounds */
     __forceinline BBox3fa getBounds() const {
       return bounds.bounds();
@@ -47,6 +47,14 @@ namespace embree
       builder->clear();
     }
 
+    void getMemoryStatistics(std::vector<RTCAccelMemoryStatistics>& stats) 
+    {
+      const size_t i = stats.size();
+      accel->getMemoryStatistics(stats);
+      if (builder && i < stats.size()) 
+        stats[i].bytesPrimRefs += builder->bytesTemporary();
+    }
+
   private:
     std::unique_ptr<AccelData> accel;
     std::unique_ptr<Builder> builder;
@@ -206,5 +206,24 @@ namespace embree
     for (size_t i=0; i<accels.size(); i++) 
       accels[i]->clear();
   }
+
+  void AccelN::getMemoryStatistics(std::vector<RTCAccelMemoryStatistics>& stats)
+  {
+    for (size_t i=0; i<accels.size(); i++) 
+      accels[i]->getMemoryStatistics(stats);
+  }
+
+  void AccelN::swap(AccelN& other)
+  {
+    std::swap(accels,other.accels);
+    std::swap(validAccels,other.validAccels);
+    std::swap(validIntersectorN,other.validIntersectorN);
+    std::swap(bounds,other.bounds);
+    std::swap(intersectors,other.intersectors);
+
+    /* intersectors of multiple acceleration structures point to the AccelN itself */
+    if (intersectors.ptr == &other) intersectors.ptr = this;
+    if (other.intersectors.ptr == this) other.intersectors.ptr = &other;
+  }
 }
 
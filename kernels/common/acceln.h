@@ -51,6 +51,8 @@ namespace embree
     void select(bool filter4, bool filter8, bool filter16, bool filterN);
     void deleteGeometry(size_t geomID);
     void clear ();
+    void getMemoryStatistics(std::vector<RTCAccelMemoryStatistics>& stats);
+    void swap (AccelN& other);
     __forceinline bool validIsecN() { return validIntersectorN; }
 
   public:
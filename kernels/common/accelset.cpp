@@ -78,4 +78,10 @@ namespace embree
   
   AccelSet::IntersectorN::IntersectorN (IntersectFuncN intersect, OccludedFuncN occluded, const char* name)
     : intersect(intersect), occluded(occluded), name(name) {}
+
+  AccelSet::IntersectorNM::IntersectorNM (ErrorFunc error) 
+    : intersect((IntersectFuncNM)error), occluded((OccludedFuncNM)error), name(nullptr) {}
+  
+  AccelSet::IntersectorNM::IntersectorNM (IntersectFuncNM intersect, OccludedFuncNM occluded, const char* name)
+    : intersect(intersect), occluded(occluded), name(name) {}
 }
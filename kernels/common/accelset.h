@@ -38,6 +38,7 @@ namespace embree
     typedef RTCIntersectFunc16 IntersectFunc16;
     typedef RTCIntersectFunc1Mp IntersectFunc1M;
     typedef RTCIntersectFuncN IntersectFuncN;
+    typedef RTCIntersectFuncNM IntersectFuncNM;
     
     typedef RTCOccludedFunc OccludedFunc;
     typedef RTCOccludedFunc4 OccludedFunc4;
@@ -45,6 +46,7 @@ namespace embree
     typedef RTCOccludedFunc16 OccludedFunc16;
     typedef RTCOccludedFunc1Mp OccludedFunc1M;
     typedef RTCOccludedFuncN OccludedFuncN;
+    typedef RTCOccludedFuncNM OccludedFuncNM;
 
 #if defined(__SSE__)
     typedef void (*ISPCIntersectFunc4)(void* ptr, RTCRay4& ray, size_t item, __m128i valid);
@@ -149,6 +151,20 @@ namespace embree
         OccludedFuncN occluded; 
         const char* name;
       };
+
+      struct IntersectorNM
+      {
+        IntersectorNM (ErrorFunc error = nullptr) ;
+        IntersectorNM (IntersectFuncNM intersect, OccludedFuncNM occluded, const char* name);
+        
+        operator bool() const { return name; }
+        
+      public:
+        static const char* type;
+        IntersectFuncNM intersect;
+        OccludedFuncNM occluded; 
+        const char* name;
+      };
       
     public:
       
@@ -228,11 +244,28 @@ namespace embree
 
   public:
 
+      /*! Intersects a packet of N rays with M items of a leaf. */
+      __forceinline void intersectNM (const int* valid, RTCRayN* rays, size_t N, const unsigned* items, size_t M, IntersectContext* context) 
+      {
+        assert(intersectors.intersectorNM.intersect);
+        intersectors.intersectorNM.intersect(valid,intersectors.ptr,context->user,rays,N,items,M);
+      }
+
+      /*! Tests if a packet of N rays is occluded by M items of a leaf. */
+      __forceinline void occludedNM (const int* valid, RTCRayN* rays, size_t N, const unsigned* items, size_t M, IntersectContext* context) 
+      {
+        assert(intersectors.intersectorNM.occluded);
+        intersectors.intersectorNM.occluded(valid,intersectors.ptr,context->user,rays,N,items,M);
+      }
+
       /*! Intersects a single ray with the scene. */
       __forceinline void intersect (Ray& ray, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-        if (likely(intersectors.intersector1.intersect)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.intersect)) {
+          int mask = -1; const unsigned primID = (unsigned) item;
+          intersectNM(&mask,(RTCRayN*)&ray,1,&primID,1,context);
+        } else if (likely(intersectors.intersector1.intersect)) { // old code for compatibility
           intersectors.intersector1.intersect(intersectors.ptr,(RTCRay&)ray,item);
         } else if (likely(intersectors.intersector1M.intersect)) {
           RTCRay* pray = (RTCRay*)&ray;
@@ -249,7 +282,10 @@ namespace embree
       __forceinline void intersect (const vbool4& valid, Ray4& ray, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-        if (likely(intersectors.intersector4.intersect)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.intersect)) {
+          vint4 mask = valid.mask32(); const unsigned primID = (unsigned) item;
+          intersectNM((int*)&mask,(RTCRayN*)&ray,4,&primID,1,context);
+        } else if (likely(intersectors.intersector4.intersect)) { // old code for compatibility
           if (intersectors.intersector4.ispc) {
             ((ISPCIntersectFunc4)intersectors.intersector4.intersect)(intersectors.ptr,(RTCRay4&)ray,item,valid.mask32());
           } else {
@@ -269,7 +305,10 @@ namespace embree
       __forceinline void intersect (const vbool8& valid, Ray8& ray, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-        if (likely(intersectors.intersector8.intersect)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.intersect)) {
+          vint8 mask = valid.mask32(); const unsigned primID = (unsigned) item;
+          intersectNM((int*)&mask,(RTCRayN*)&ray,8,&primID,1,context);
+        } else if (likely(intersectors.intersector8.intersect)) { // old code for compatibility
           if (intersectors.intersector8.ispc) {
             ((ISPCIntersectFunc8)intersectors.intersector8.intersect)(intersectors.ptr,(RTCRay8&)ray,item,valid.mask32());
           } else {
@@ -289,7 +328,10 @@ namespace embree
       __forceinline void intersect (const vbool16& valid, Ray16& ray, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-        if (likely(intersectors.intersector16.intersect)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.intersect)) {
+          vint16 mask = valid.mask32(); const unsigned primID = (unsigned) item;
+          intersectNM((int*)&mask,(RTCRayN*)&ray,16,&primID,1,context);
+        } else if (likely(intersectors.intersector16.intersect)) { // old code for compatibility
           if (intersectors.intersector16.ispc) {
             ((ISPCIntersectFunc16)intersectors.intersector16.intersect)(intersectors.ptr,(RTCRay16&)ray,item,valid.mask8());
           } else {
@@ -308,21 +350,31 @@ namespace embree
       __forceinline void intersect1M (Ray** rays, size_t N, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-        if (intersectors.intersector1M.intersect) { // Intersect1N callback is optional
+        if (intersectors.intersector1M.intersect && !intersectors.intersectorNM.intersect) { // Intersect1N callback is optional
           intersectors.intersector1M.intersect(intersectors.ptr,context->user,(RTCRay**)rays,N,item);
         }
         else if (N == 1) {
           int mask = -1;
-          assert(intersectors.intersectorN.intersect);
-          intersectors.intersectorN.intersect((int*)&mask,intersectors.ptr,context->user,(RTCRayN*)rays[0],1,item);
+          const unsigned primID = (unsigned) item;
+          if (unlikely(intersectors.intersectorNM.intersect)) {
+            intersectNM(&mask,(RTCRayN*)rays[0],1,&primID,1,context);
+          } else {
+            assert(intersectors.intersectorN.intersect);
+            intersectors.intersectorN.intersect((int*)&mask,intersectors.ptr,context->user,(RTCRayN*)rays[0],1,item);
+          }
         } 
         else 
         {
           int mask[MAX_INTERNAL_STREAM_SIZE];
+          const unsigned primID = (unsigned) item;
           StackRayPacket<MAX_INTERNAL_STREAM_SIZE> packet(N);
           for (size_t i=0; i<N; i++) packet.writeRay(i,mask,*rays[i]);
-          assert(intersectors.intersectorN.intersect);
-          intersectors.intersectorN.intersect(mask,intersectors.ptr,context->user,(RTCRayN*)packet.data,N,item);
+          if (unlikely(intersectors.intersectorNM.intersect)) {
+            intersectNM(mask,(RTCRayN*)packet.data,N,&primID,1,context);
+          } else {
+            assert(intersectors.intersectorN.intersect);
+            intersectors.intersectorN.intersect(mask,intersectors.ptr,context->user,(RTCRayN*)packet.data,N,item);
+          }
           for (size_t i=0; i<N; i++) packet.readHit(i,*rays[i]);
         }
       }
@@ -330,7 +382,10 @@ namespace embree
       /*! Tests if single ray is occluded by the scene. */
       __forceinline void occluded (Ray& ray, size_t item, IntersectContext* context) 
       {
-        if (likely(intersectors.intersector1.occluded)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.occluded)) {
+          int mask = -1; const unsigned primID = (unsigned) item;
+          occludedNM(&mask,(RTCRayN*)&ray,1,&primID,1,context);
+        } else if (likely(intersectors.intersector1.occluded)) { // old code for compatibility
           intersectors.intersector1.occluded(intersectors.ptr,(RTCRay&)ray,item);
         } else if (likely(intersectors.intersector1M.occluded)) {
           RTCRay* pray = (RTCRay*)&ray;
@@ -347,7 +402,10 @@ namespace embree
       __forceinline void occluded (const vbool4& valid, Ray4& ray, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-	if (likely(intersectors.intersector4.occluded)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.occluded)) {
+          vint4 mask = valid.mask32(); const unsigned primID = (unsigned) item;
+          occludedNM((int*)&mask,(RTCRayN*)&ray,4,&primID,1,context);
+        } else if (likely(intersectors.intersector4.occluded)) { // old code for compatibility
           if (intersectors.intersector4.ispc) {
             ((ISPCOccludedFunc4)intersectors.intersector4.occluded)(intersectors.ptr,(RTCRay4&)ray,item,valid.mask32());
           } else {
@@ -367,7 +425,10 @@ namespace embree
       __forceinline void occluded (const vbool8& valid, Ray8& ray, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-	if (likely(intersectors.intersector8.occluded)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.occluded)) {
+          vint8 mask = valid.mask32(); const unsigned primID = (unsigned) item;
+          occludedNM((int*)&mask,(RTCRayN*)&ray,8,&primID,1,context);
+        } else if (likely(intersectors.intersector8.occluded)) { // old code for compatibility
           if (intersectors.intersector8.ispc) {
             ((ISPCOccludedFunc8)intersectors.intersector8.occluded)(intersectors.ptr,(RTCRay8&)ray,item,valid.mask32());
           } else {
@@ -387,7 +448,10 @@ namespace embree
       __forceinline void occluded (const vbool16& valid, Ray16& ray, size_t item, IntersectContext* context) 
       {
         assert(item < size());
-        if (likely(intersectors.intersector16.occluded)) { // old code for compatibility
+        if (unlikely(intersectors.intersectorNM.occluded)) {
+          vint16 mask = valid.mask32(); const unsigned primID = (unsigned) item;
+          occludedNM((int*)&mask,(RTCRayN*)&ray,16,&primID,1,context);
+        } else if (likely(intersectors.intersector16.occluded)) { // old code for compatibility
           if (intersectors.intersector16.ispc) {
             ((ISPCOccludedFunc16)intersectors.intersector16.occluded)(intersectors.ptr,(RTCRay16&)ray,item,valid.mask8());
           }
@@ -406,21 +470,31 @@ namespace embree
       /*! Tests if a stream of rays is occluded by the scene. */
       __forceinline void occluded1M (Ray** rays, size_t N, size_t item, IntersectContext* context) 
       {
-        if (likely(intersectors.intersector1M.occluded)) { // Occluded1N callback is optional
+        if (likely(intersectors.intersector1M.occluded && !intersectors.intersectorNM.occluded)) { // Occluded1N callback is optional
           intersectors.intersector1M.occluded(intersectors.ptr,context->user,(RTCRay**)rays,N,item);
         }
         else if (N == 1) {
           int mask = -1;
-          assert(intersectors.intersectorN.occluded);
-          intersectors.intersectorN.occluded((int*)&mask,intersectors.ptr,context->user,(RTCRayN*)rays[0],1,item);
+          const unsigned primID = (unsigned) item;
+          if (unlikely(intersectors.intersectorNM.occluded)) {
+            occludedNM(&mask,(RTCRayN*)rays[0],1,&primID,1,context);
+          } else {
+            assert(intersectors.intersectorN.occluded);
+            intersectors.intersectorN.occluded((int*)&mask,intersectors.ptr,context->user,(RTCRayN*)rays[0],1,item);
+          }
         } 
         else 
         {
           int mask[MAX_INTERNAL_STREAM_SIZE];
+          const unsigned primID = (unsigned) item;
           StackRayPacket<MAX_INTERNAL_STREAM_SIZE> packet(N);
           for (size_t i=0; i<N; i++) packet.writeRay(i,mask,*rays[i]);
-          assert(intersectors.intersectorN.occluded);
-          intersectors.intersectorN.occluded(mask,intersectors.ptr,context->user,(RTCRayN*)packet.data,N,item);
+          if (unlikely(intersectors.intersectorNM.occluded)) {
+            occludedNM(mask,(RTCRayN*)packet.data,N,&primID,1,context);
+          } else {
+            assert(intersectors.intersectorN.occluded);
+            intersectors.intersectorN.occluded(mask,intersectors.ptr,context->user,(RTCRayN*)packet.data,N,item);
+          }
           for (size_t i=0; i<N; i++) packet.readOcclusion(i,*rays[i]);
         }
       }
@@ -442,6 +516,7 @@ namespace embree
         Intersector16 intersector16;
         Intersector1M intersector1M;
         IntersectorN intersectorN;
+        IntersectorNM intersectorNM;
       } intersectors;
   };
   
@@ -32,6 +32,8 @@ namespace embree
     //static const size_t defaultBlockSize = 4096;
 #define maxAllocationSize size_t(4*1024*1024-maxAlignment)
     static const size_t MAX_THREAD_USED_BLOCK_SLOTS = 8;
+
+    struct Block;
     
   public:
 
@@ -171,7 +173,8 @@ namespace embree
 
     FastAllocator (Device* device, bool osAllocation) 
       : device(device), slotMask(0), usedBlocks(nullptr), freeBlocks(nullptr), use_single_mode(false), defaultBlockSize(PAGE_SIZE), 
-        growSize(PAGE_SIZE), log2_grow_size_scale(0), bytesUsed(0), bytesWasted(0), thread_local_allocators2(this), atype(osAllocation ? OS_MALLOC : ALIGNED_MALLOC)
+        growSize(PAGE_SIZE), log2_grow_size_scale(0), bytesUsed(0), bytesWasted(0), thread_local_allocators2(this), atype(osAllocation ? OS_MALLOC : ALIGNED_MALLOC),
+        numNodes(getNumberOfNUMANodes()), bytesEstimate(0), bytesEstimatePrevBuild(0), bytesUsedPrevBuild(0)
     {
       for (size_t i=0; i<MAX_THREAD_USED_BLOCK_SLOTS; i++)
       {
@@ -236,7 +239,8 @@ namespace embree
       internal_fix_used_blocks();
       /* distribute the allocation to multiple thread block slots */
       slotMask = MAX_THREAD_USED_BLOCK_SLOTS-1;      
-      if (usedBlocks.load() || freeBlocks.load()) { reset(); return; }
+      if (usedBlocks.load() || freeBlocks.load()) { reset(); bytesEstimate = 0; return; }
+      bytesEstimate = 0;
       if (bytesReserve == 0) bytesReserve = bytesAllocate;
       freeBlocks = Block::create(device,bytesAllocate,bytesReserve,nullptr,atype);
       defaultBlockSize = clamp(bytesAllocate/4,size_t(128),size_t(PAGE_SIZE+maxAlignment)); 
@@ -247,12 +251,67 @@ namespace embree
     void init_estimate(size_t bytesAllocate, const bool single_mode = false) 
     {      
       internal_fix_used_blocks();
-      if (usedBlocks.load() || freeBlocks.load()) { reset(); return; }
+      if (usedBlocks.load() || freeBlocks.load()) 
+      {
+        reset(); 
+        bytesEstimate = bytesAllocate;
+
+        /* keep the block list if it can hold the predicted amount of memory */
+        const size_t bytesPredicted = predictBytes(bytesAllocate,single_mode);
+        if (bytesPredicted == 0) return;
+        if (freeBlocks.load()->next == nullptr && freeBlocks.load()->getBlockReservedBytes() >= bytesPredicted) { slotMask = 0x0; return; }
+
+        /* replace a fragmented or too small block list by a single block */
+        freeBlocks.load()->clear_list(device); freeBlocks = nullptr;
+        createPredictedBlock(bytesPredicted);
+        return;
+      }
+      bytesEstimate = bytesAllocate;
       /* single allocator mode ? */
       use_single_mode = single_mode; 
       defaultBlockSize = clamp(bytesAllocate/4,size_t(128),size_t(PAGE_SIZE+maxAlignment)); 
       /* if in memory conservative single_mode, reduce bytesAllocate/growSize by 2 */
       initGrowSizeAndNumSlots(single_mode == false ? bytesAllocate : bytesAllocate/2);
+
+      /* pre-reserve memory if a previous build of this allocator got recorded */
+      const size_t bytesPredicted = predictBytes(bytesAllocate,single_mode);
+      if (bytesPredicted) createPredictedBlock(bytesPredicted);
+    }
+
+    /*! records how many bytes the last build drew from the memory blocks */
+    void recordBuildStatistics()
+    {
+      if (usedBlocks.load() == nullptr || bytesEstimate == 0) return;
+      bytesUsedPrevBuild = usedBlocks.load()->getUsedBytes();
+      bytesEstimatePrevBuild = bytesEstimate;
+    }
+
+    /*! predicts the bytes a build requires from the statistics of the
+     *  previous build, returns 0 if no prediction is possible */
+    size_t predictBytes(size_t bytesAllocate, bool single_mode) const
+    {
+      if (single_mode || numNodes > 1) return 0;
+      if (bytesUsedPrevBuild == 0 || bytesEstimatePrevBuild == 0) return 0;
+      
+      /* scale by the change of the estimate, add some margin and the
+       * partially used thread local blocks */
+      const double scale = 1.1*double(bytesAllocate)/double(bytesEstimatePrevBuild);
+      const size_t bytesThreads = 2*TaskScheduler::threadCount()*(defaultBlockSize+maxAlignment);
+      size_t bytes = size_t(scale*double(bytesUsedPrevBuild)) + bytesThreads;
+
+      /* large blocks cover full huge pages, which wastes at most 12.5% */
+      const size_t sizeof_Header = offsetof(Block,data[0]);
+      if (bytes+sizeof_Header >= 8*PAGE_SIZE_2M) 
+        bytes = ((bytes+sizeof_Header+PAGE_SIZE_2M-1) & ~(PAGE_SIZE_2M-1))-sizeof_Header;
+      return bytes;
+    }
+
+    /*! creates a single block for the predicted memory of a build, which
+     *  all threads allocate from */
+    void createPredictedBlock(size_t bytes)
+    {
+      freeBlocks = Block::create(device,bytes,bytes,nullptr,OS_MALLOC);
+      slotMask = 0x0;
     }
 
     /*! frees state not required after build */
@@ -281,6 +340,7 @@ namespace embree
     void reset () 
     {
       internal_fix_used_blocks();
+      recordBuildStatistics();
 
       bytesUsed = 0;
       bytesWasted = 0;
@@ -310,6 +370,7 @@ namespace embree
     __forceinline void clear()
     {
       cleanup();
+      recordBuildStatistics();
       bytesUsed = 0;
       bytesWasted = 0;
       if (usedBlocks.load() != nullptr) usedBlocks.load()->clear_list(device); usedBlocks = nullptr;
@@ -326,6 +387,40 @@ namespace embree
       return size_t(1) << min(size_t(16),scale);
     }
 
+    /*! returns the NUMA node of the calling thread */
+    __forceinline int getNode() const 
+    {
+      if (likely(numNodes <= 1)) return 0;
+      return max(0,getCPUTopology(getCurrentCPU()).node);
+    }
+
+    /*! selects the block slot of a thread, threads of different NUMA
+     *  nodes use different slots, such that all memory of a block gets
+     *  first touched by threads of the same node */
+    __forceinline size_t getSlot(size_t threadIndex, int node) const
+    {
+      if (likely(numNodes <= 1)) return threadIndex & slotMask;
+      const size_t numSlots = slotMask+1;
+      const size_t slotsPerNode = max(size_t(1),numSlots/numNodes);
+      return (node + (threadIndex % slotsPerNode)*numNodes) % numSlots;
+    }
+
+    /*! removes a free block from the free list, preferring blocks of the given NUMA node */
+    __forceinline Block* takeFreeBlock(int node)
+    {
+      Block* prev = nullptr;
+      Block* block = freeBlocks.load();
+      if (numNodes > 1) 
+      {
+        for (Block* p = nullptr, *b = block; b; p = b, b = b->next) {
+          if (b->node == node) { prev = p; block = b; break; }
+        }
+      }
+      if (prev) prev->next = block->next;
+      else      freeBlocks = block->next;
+      return block;
+    }
+
     /*! thread safe allocation of memory */
     void* malloc(size_t& bytes, size_t align, bool partial) 
     {
@@ -335,7 +430,8 @@ namespace embree
       {
         /* allocate using current block */
         size_t threadIndex = TaskScheduler::threadIndex();
-        size_t slot = threadIndex & slotMask;
+        const int node = getNode();
+        size_t slot = getSlot(threadIndex,node);
 	Block* myUsedBlocks = threadUsedBlocks[slot];
         if (myUsedBlocks) {
           void* ptr = myUsedBlocks->malloc(device,bytes,align,partial); 
@@ -353,7 +449,7 @@ namespace embree
           if (myUsedBlocks == threadUsedBlocks[slot]) {
             const size_t allocSize = min(max(growSize,bytes),size_t(maxAllocationSize));
             assert(allocSize >= bytes);
-            threadBlocks[slot] = threadUsedBlocks[slot] = Block::create(device,allocSize,allocSize,threadBlocks[slot],atype);
+            threadBlocks[slot] = threadUsedBlocks[slot] = Block::create(device,allocSize,allocSize,threadBlocks[slot],atype,node);
           }
           continue;
         }        
@@ -364,16 +460,15 @@ namespace embree
 	  if (myUsedBlocks == threadUsedBlocks[slot])
 	  {
             if (freeBlocks.load() != nullptr) {
-	      Block* nextFreeBlock = freeBlocks.load()->next;
-	      freeBlocks.load()->next = usedBlocks;
+	      Block* freeBlock = takeFreeBlock(node);
+	      freeBlock->next = usedBlocks;
 	      __memory_barrier();
-	      usedBlocks = freeBlocks.load();
-              threadUsedBlocks[slot] = freeBlocks.load();
-	      freeBlocks = nextFreeBlock;
+	      usedBlocks = freeBlock;
+              threadUsedBlocks[slot] = freeBlock;
 	    } else {
 	      //growSize = min(2*growSize,size_t(maxAllocationSize+maxAlignment));
               const size_t allocSize = min(growSize * incGrowSizeScale(),size_t(maxAllocationSize+maxAlignment))-maxAlignment;
-	      usedBlocks = threadUsedBlocks[slot] = Block::create(device,allocSize,allocSize,usedBlocks,atype);
+	      usedBlocks = threadUsedBlocks[slot] = Block::create(device,allocSize,allocSize,usedBlocks,atype,node);
 	    }
 	  }
         }
@@ -461,6 +556,7 @@ namespace embree
         std::cout << "  slotMask = " << slotMask << std::endl;
         std::cout << "  use_single_mode = " << use_single_mode << std::endl;
         std::cout << "  defaultBlockSize = " << defaultBlockSize << std::endl;
+        std::cout << "  bytesUsedPrevBuild = " << bytesUsedPrevBuild << std::endl;
         std::cout << "  used blocks = ";
         if (usedBlocks.load() != nullptr) usedBlocks.load()->print_list();
         std::cout << "[END]" << std::endl;
@@ -475,11 +571,15 @@ namespace embree
 
     struct Block 
     {
-      static Block* create(MemoryMonitorInterface* device, size_t bytesAllocate, size_t bytesReserve, Block* next, AllocationType atype)
+      static Block* create(Device* device, size_t bytesAllocate, size_t bytesReserve, Block* next, AllocationType atype, int node = -1)
       {
         const size_t sizeof_Header = offsetof(Block,data[0]);
         bytesAllocate = ((sizeof_Header+bytesAllocate+PAGE_SIZE-1) & ~(PAGE_SIZE-1)); // always consume full pages
         bytesReserve  = ((sizeof_Header+bytesReserve +PAGE_SIZE-1) & ~(PAGE_SIZE-1)); // always consume full pages
+
+        /* only memory allocated with os_malloc can stay mapped */
+        if (atype == ALIGNED_MALLOC && device && device->recycler.getMaxBytes())
+          atype = OS_MALLOC;
        
         /* either use alignedMalloc or os_reserve/os_commit */
         void *ptr = nullptr;
@@ -498,36 +598,55 @@ namespace embree
             /* second os_advise should succeed as with 4M block */
             os_advise((void*)(ptr_aligned_begin + PAGE_SIZE_2M),PAGE_SIZE_2M);
             
-            return new (ptr) Block(atype,bytesAllocate-sizeof_Header,bytesAllocate-sizeof_Header,next,alignment);
+            return new (ptr) Block(atype,bytesAllocate-sizeof_Header,bytesAllocate-sizeof_Header,next,alignment,node);
           }
           else 
           {
             const size_t alignment = CACHELINE_SIZE;
             if (device) device->memoryMonitor(bytesAllocate+alignment,false);
             ptr = alignedMalloc(bytesAllocate,alignment);
-            return new (ptr) Block(atype,bytesAllocate-sizeof_Header,bytesAllocate-sizeof_Header,next,alignment);
+            return new (ptr) Block(atype,bytesAllocate-sizeof_Header,bytesAllocate-sizeof_Header,next,alignment,node);
           }
         } 
         else if (atype == OS_MALLOC)
         {
-          if (device) device->memoryMonitor(bytesAllocate,false);
-          ptr = os_reserve(bytesReserve);
+          /* reuse memory the device kept mapped */
+          size_t bytesRecycled = bytesReserve;
+          HugePageMode hugePages = HUGE_PAGES_NEVER;
+          ptr = device ? device->recycler.take(bytesRecycled,hugePages) : nullptr;
+          if (ptr) 
+          {
+            try {
+              device->memoryMonitor(bytesAllocate,false);
+            } catch (...) {
+              if (!device->recycler.give(ptr,bytesRecycled,hugePages)) device->osFree(ptr,bytesRecycled,hugePages);
+              throw;
+            }
+            return new (ptr) Block(atype,bytesAllocate-sizeof_Header,bytesRecycled-sizeof_Header,next,0,node,hugePages);
+          }
+
+          if (device) {
+            device->memoryMonitor(bytesAllocate,false);
+            ptr = device->osMalloc(bytesReserve,Device::MEMORY_ACCEL,hugePages);
+          }
+          else
+            ptr = os_reserve(bytesReserve);
           os_commit(ptr,bytesAllocate);
-          return new (ptr) Block(atype,bytesAllocate-sizeof_Header,bytesReserve-sizeof_Header,next,0);
+          return new (ptr) Block(atype,bytesAllocate-sizeof_Header,bytesReserve-sizeof_Header,next,0,node,hugePages);
         }
         else
           assert(false);
         return NULL;
       }
 
-      Block (AllocationType atype, size_t bytesAllocate, size_t bytesReserve, Block* next, size_t wasted) 
-      : cur(0), allocEnd(bytesAllocate), reserveEnd(bytesReserve), next(next), wasted(wasted), atype(atype)
+      Block (AllocationType atype, size_t bytesAllocate, size_t bytesReserve, Block* next, size_t wasted, int node = -1, HugePageMode hugePages = HUGE_PAGES_NEVER) 
+      : cur(0), allocEnd(bytesAllocate), reserveEnd(bytesReserve), next(next), wasted(wasted), atype(atype), node(node), hugePages(hugePages)
       {
         assert((((size_t)&data[0]) & (maxAlignment-1)) == 0);
         //for (size_t i=0; i<allocEnd; i+=defaultBlockSize) data[i] = 0;
       }
 
-      void clear_list(MemoryMonitorInterface* device) 
+      void clear_list(Device* device) 
       {
         Block* block = this;
         while (block) {
@@ -537,7 +656,7 @@ namespace embree
         }
       }
 
-      void clear_block (MemoryMonitorInterface* device) 
+      void clear_block (Device* device) 
       {
         const size_t sizeof_Header = offsetof(Block,data[0]);
         const ssize_t sizeof_Alloced = wasted+sizeof_Header+getBlockAllocatedBytes();
@@ -549,7 +668,10 @@ namespace embree
 
         else if (atype == OS_MALLOC) {
          size_t sizeof_This = sizeof_Header+reserveEnd;
-         os_free(this,sizeof_This);
+         if (!device) 
+           os_free(this,sizeof_This);
+         else if (!device->recycler.give(this,sizeof_This,hugePages))
+           device->osFree(this,sizeof_This,hugePages);
          if (device) device->memoryMonitor(-sizeof_Alloced,true);
         } 
 
@@ -592,19 +714,21 @@ namespace embree
         cur = 0;
       }
 
-      void shrink_list (MemoryMonitorInterface* device) 
+      void shrink_list (Device* device) 
       {
         for (Block* block = this; block; block = block->next)
           block->shrink_block(device);
       }
    
-      void shrink_block (MemoryMonitorInterface* device) 
+      void shrink_block (Device* device) 
       {
-        if (atype == OS_MALLOC)
+        /* pages of the hugetlbfs pool cannot get partially unmapped */
+        if (atype == OS_MALLOC && (hugePages == HUGE_PAGES_NEVER || hugePages == HUGE_PAGES_MADVISE))
         {
           const size_t sizeof_Header = offsetof(Block,data[0]);
           size_t newSize = os_shrink(this,sizeof_Header+getBlockUsedBytes(),reserveEnd+sizeof_Header);
           if (device) device->memoryMonitor(newSize-sizeof_Header-allocEnd,true);
+          if (device && hugePages == HUGE_PAGES_MADVISE) device->hugePageAdvisedBytes -= reserveEnd+sizeof_Header-newSize;
           reserveEnd = allocEnd = newSize-sizeof_Header;
         }
       }
@@ -674,7 +798,9 @@ namespace embree
       Block* next;               //!< pointer to next block in list
       size_t wasted;             //!< amount of memory wasted through block alignment
       AllocationType atype;      //!< allocation mode of the block
-      char align[maxAlignment-5*sizeof(size_t)-sizeof(AllocationType)]; //!< align data to maxAlignment
+      int node;                  //!< NUMA node of the threads that first touch the block, -1 if unknown
+      HugePageMode hugePages;    //!< huge page policy applied when mapping the block
+      char align[maxAlignment-5*sizeof(size_t)-sizeof(AllocationType)-sizeof(int)-sizeof(HugePageMode)]; //!< align data to maxAlignment
       char data[1];              //!< here starts memory to use for allocations
     };
 
@@ -697,5 +823,9 @@ namespace embree
     size_t bytesWasted;          //!< number of total wasted bytes
     ThreadLocalData<ThreadLocal2,FastAllocator*> thread_local_allocators2; //!< thread local allocators
     AllocationType atype;
+    size_t numNodes;             //!< number of NUMA nodes
+    size_t bytesEstimate;          //!< estimate passed to init_estimate by the current build, 0 if unknown
+    size_t bytesEstimatePrevBuild; //!< estimate passed to init_estimate by the previous build
+    size_t bytesUsedPrevBuild;     //!< number of bytes the previous build drew from the memory blocks
   };
 }
@@ -37,6 +37,9 @@ namespace embree
 
     /*! clears internal builder state */
     virtual void clear() = 0;
+
+    /*! returns the bytes of temporary build data kept for later builds */
+    virtual size_t bytesTemporary() const { return 0; }
   };
 
   /*! virtual interface for progress monitor class */
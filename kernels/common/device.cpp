@@ -48,9 +48,53 @@ namespace embree
   static std::map<Device*,size_t> g_cache_size_map;
   static std::map<Device*,size_t> g_num_threads_map;
 
+#if defined(TASKING_INTERNAL)
+
+  /*! idle policy of the worker threads requested by one device */
+  struct TaskingIdlePolicy
+  {
+    TaskingIdlePolicy () 
+      : spinRounds(32), backoffRounds(0), parking(false) {}
+
+    size_t spinRounds;
+    size_t backoffRounds;
+    bool parking;
+  };
+  static std::map<Device*,TaskingIdlePolicy> g_idle_policy_map;
+
+  /*! all devices share the worker threads, thus they use the most
+   *  responsive policy requested by any device: the maximal number of
+   *  spinning and sleeping rounds, and parking only if all devices allow it */
+  static void updateTaskingIdlePolicy()
+  {
+    TaskingIdlePolicy policy;
+    if (g_idle_policy_map.size()) {
+      policy.spinRounds = 0;
+      policy.parking = true;
+    }
+    for (auto& i : g_idle_policy_map) {
+      policy.spinRounds    = max(policy.spinRounds,   i.second.spinRounds);
+      policy.backoffRounds = max(policy.backoffRounds,i.second.backoffRounds);
+      policy.parking      &= i.second.parking;
+    }
+    TaskScheduler::g_idleSpinRounds    = policy.spinRounds;
+    TaskScheduler::g_idleBackoffRounds = policy.backoffRounds;
+    TaskScheduler::g_idleParking       = policy.parking;
+  }
+#endif
+
   Device::Device (const char* cfg, bool singledevice)
-    : State(singledevice)
+    : State(singledevice), hugePageMode(HUGE_PAGES_EXPLICIT), hugePageBytes(0), hugePageAdvisedBytes(0),
+      recycler([this] (void* ptr, size_t bytes, HugePageMode mode) { osFree(ptr,bytes,mode); })
   {
+    /* large build arrays only use OS allocations on KNL by default */
+    hugePageMinBytes[MEMORY_ACCEL] = PAGE_SIZE_2M;
+#if defined(__LINUX__) && defined(__AVX512ER__) // KNL
+    hugePageMinBytes[MEMORY_BUILD] = 14 * PAGE_SIZE_2M;
+#else
+    hugePageMinBytes[MEMORY_BUILD] = 0;
+#endif
+
     /* initialize global state */
     State::parseString(cfg);
     if (!ignore_config_files && FileName::executableFolder() != FileName(""))
@@ -294,6 +338,53 @@ namespace embree
     }
   }
 
+  void* Device::osMalloc(size_t bytes, MemoryClass mclass, HugePageMode& mode)
+  {
+    mode = bytes >= hugePageMinBytes[mclass] ? hugePageMode : HUGE_PAGES_NEVER;
+    void* ptr = mclass == MEMORY_ACCEL ? os_reserve(bytes,mode) : os_malloc(bytes,mode);
+
+    const size_t pageSize = os_page_size(mode);
+    const size_t bytesMapped = (bytes+pageSize-1) & ~(pageSize-1);
+    if      (mode == HUGE_PAGES_MADVISE) hugePageAdvisedBytes += bytesMapped;
+    else if (mode != HUGE_PAGES_NEVER  ) hugePageBytes += bytesMapped;
+    return ptr;
+  }
+
+  void Device::osFree(void* ptr, size_t bytes, HugePageMode mode)
+  {
+    const size_t pageSize = os_page_size(mode);
+    const size_t bytesMapped = (bytes+pageSize-1) & ~(pageSize-1);
+    if      (mode == HUGE_PAGES_MADVISE) hugePageAdvisedBytes -= bytesMapped;
+    else if (mode != HUGE_PAGES_NEVER  ) hugePageBytes -= bytesMapped;
+    os_free(ptr,bytes,mode);
+  }
+
+  void* Device::osMallocArray(size_t bytes)
+  {
+    if (hugePageMinBytes[MEMORY_BUILD] == 0 || bytes < hugePageMinBytes[MEMORY_BUILD])
+      return nullptr;
+
+    HugePageMode mode;
+    void* ptr = osMalloc(bytes,MEMORY_BUILD,mode);
+    Lock<SpinLock> lock(buildArraysMutex);
+    buildArrays[ptr] = mode;
+    return ptr;
+  }
+
+  bool Device::osFreeArray(void* ptr, size_t bytes)
+  {
+    HugePageMode mode;
+    {
+      Lock<SpinLock> lock(buildArraysMutex);
+      auto i = buildArrays.find(ptr);
+      if (i == buildArrays.end()) return false;
+      mode = i->second;
+      buildArrays.erase(i);
+    }
+    osFree(ptr,bytes,mode);
+    return true;
+  }
+
   size_t getMaxNumThreads()
   {
     size_t maxNumThreads = 0;
@@ -331,6 +422,10 @@ namespace embree
       g_num_threads_map[this] = std::numeric_limits<size_t>::max();
     else 
       g_num_threads_map[this] = numThreads;
+#if defined(TASKING_INTERNAL)
+    g_idle_policy_map[this] = TaskingIdlePolicy();
+    updateTaskingIdlePolicy();
+#endif
 
     /* create task scheduler */
     size_t maxNumThreads = getMaxNumThreads();
@@ -344,6 +439,10 @@ namespace embree
   {
     Lock<MutexSys> lock(g_mutex);
     g_num_threads_map.erase(this);
+#if defined(TASKING_INTERNAL)
+    g_idle_policy_map.erase(this);
+    updateTaskingIdlePolicy();
+#endif
 
     /* terminate tasking system */
     if (g_num_threads_map.size() == 0) {
@@ -372,6 +471,26 @@ namespace embree
 
     switch (parm) {
     case RTC_SOFTWARE_CACHE_SIZE: setCacheSize(val); break;
+#if defined(EMBREE_GEOMETRY_SUBDIV)
+    case RTC_SOFTWARE_CACHE_RESET_STATISTICS: SharedTessellationCacheStats::clearStats(); break;
+#else
+    case RTC_SOFTWARE_CACHE_RESET_STATISTICS: break;
+#endif
+#if defined(TASKING_INTERNAL)
+    case RTC_TASKING_IDLE_SPIN_ROUNDS   : { Lock<MutexSys> lock(g_mutex); g_idle_policy_map[this].spinRounds = max(ssize_t(0),val); updateTaskingIdlePolicy(); break; }
+    case RTC_TASKING_IDLE_BACKOFF_ROUNDS: { Lock<MutexSys> lock(g_mutex); g_idle_policy_map[this].backoffRounds = max(ssize_t(0),val); updateTaskingIdlePolicy(); break; }
+    case RTC_TASKING_IDLE_PARKING       : { Lock<MutexSys> lock(g_mutex); g_idle_policy_map[this].parking = val != 0; updateTaskingIdlePolicy(); break; }
+#else
+    case RTC_TASKING_IDLE_SPIN_ROUNDS   : break;
+    case RTC_TASKING_IDLE_BACKOFF_ROUNDS: break;
+    case RTC_TASKING_IDLE_PARKING       : break;
+#endif
+    case RTC_MEMORY_RECYCLE_MAX_BYTES: recycler.setMaxBytes(max(ssize_t(0),val)); break;
+    case RTC_HUGE_PAGE_MODE: 
+      if (val < HUGE_PAGES_NEVER || val > HUGE_PAGES_1G) throw_RTCError(RTC_INVALID_ARGUMENT, "invalid huge page mode");
+      hugePageMode = (HugePageMode) val; break;
+    case RTC_HUGE_PAGE_MIN_BYTES_ACCEL: hugePageMinBytes[MEMORY_ACCEL] = max(ssize_t(0),val); break;
+    case RTC_HUGE_PAGE_MIN_BYTES_BUILD: hugePageMinBytes[MEMORY_BUILD] = max(ssize_t(0),val); break;
     default: throw_RTCError(RTC_INVALID_ARGUMENT, "unknown writable parameter"); break;
     };
   }
@@ -486,6 +605,12 @@ namespace embree
     case RTC_CONFIG_LINE_GEOMETRY: return 0;
 #endif
 
+#if defined(EMBREE_GEOMETRY_POINTS)
+    case RTC_CONFIG_POINT_GEOMETRY: return 1;
+#else
+    case RTC_CONFIG_POINT_GEOMETRY: return 0;
+#endif
+
 #if defined(EMBREE_GEOMETRY_HAIR)
     case RTC_CONFIG_HAIR_GEOMETRY: return 1;
 #else
@@ -504,6 +629,45 @@ namespace embree
     case RTC_CONFIG_USER_GEOMETRY: return 0;
 #endif
 
+#if defined(EMBREE_GEOMETRY_SUBDIV)
+    case RTC_SOFTWARE_CACHE_SIZE      : return SharedLazyTessellationCache::sharedLazyTessellationCache.getSize();
+    case RTC_SOFTWARE_CACHE_USED_BYTES: return SharedTessellationCacheStats::getStats().usedBytes;
+    case RTC_SOFTWARE_CACHE_ACCESSES  : return SharedTessellationCacheStats::getStats().accesses;
+    case RTC_SOFTWARE_CACHE_HITS      : return SharedTessellationCacheStats::getStats().hits;
+    case RTC_SOFTWARE_CACHE_MISSES    : return SharedTessellationCacheStats::getStats().misses;
+    case RTC_SOFTWARE_CACHE_FLUSHES   : return SharedTessellationCacheStats::getStats().flushes;
+    case RTC_SOFTWARE_CACHE_CONTENTION: return SharedTessellationCacheStats::getStats().contention;
+#else
+    case RTC_SOFTWARE_CACHE_SIZE      : return 0;
+    case RTC_SOFTWARE_CACHE_USED_BYTES: return 0;
+    case RTC_SOFTWARE_CACHE_ACCESSES  : return 0;
+    case RTC_SOFTWARE_CACHE_HITS      : return 0;
+    case RTC_SOFTWARE_CACHE_MISSES    : return 0;
+    case RTC_SOFTWARE_CACHE_FLUSHES   : return 0;
+    case RTC_SOFTWARE_CACHE_CONTENTION: return 0;
+#endif
+
+#if defined(TASKING_INTERNAL)
+    case RTC_TASKING_IDLE_SPIN_ROUNDS   : { Lock<MutexSys> lock(g_mutex); return g_idle_policy_map[this].spinRounds; }
+    case RTC_TASKING_IDLE_BACKOFF_ROUNDS: { Lock<MutexSys> lock(g_mutex); return g_idle_policy_map[this].backoffRounds; }
+    case RTC_TASKING_IDLE_PARKING       : { Lock<MutexSys> lock(g_mutex); return g_idle_policy_map[this].parking; }
+    case RTC_TASKING_IDLE_PARK_COUNT    : return TaskScheduler::g_numParks;
+#else
+    case RTC_TASKING_IDLE_SPIN_ROUNDS   : return 0;
+    case RTC_TASKING_IDLE_BACKOFF_ROUNDS: return 0;
+    case RTC_TASKING_IDLE_PARKING       : return 0;
+    case RTC_TASKING_IDLE_PARK_COUNT    : return 0;
+#endif
+
+    case RTC_MEMORY_RECYCLE_MAX_BYTES: return recycler.getMaxBytes();
+    case RTC_MEMORY_RECYCLED_BYTES   : return recycler.getCachedBytes();
+    case RTC_MEMORY_RECYCLE_COUNT    : return recycler.getNumRecycled();
+    case RTC_HUGE_PAGE_MODE           : return hugePageMode;
+    case RTC_HUGE_PAGE_MIN_BYTES_ACCEL: return hugePageMinBytes[MEMORY_ACCEL];
+    case RTC_HUGE_PAGE_MIN_BYTES_BUILD: return hugePageMinBytes[MEMORY_BUILD];
+    case RTC_HUGE_PAGE_BYTES          : return hugePageBytes;
+    case RTC_HUGE_PAGE_ADVISED_BYTES  : return hugePageAdvisedBytes;
+
 #if defined(TASKING_TBB) && (TBB_INTERFACE_VERSION_MAJOR < 8)
     case RTC_CONFIG_COMMIT_JOIN: return 0;
     case RTC_CONFIG_COMMIT_THREAD: return 0;
@@ -19,6 +19,7 @@
 #include "default.h"
 #include "state.h"
 #include "accel.h"
+#include "recycler.h"
 
 namespace embree
 {
@@ -59,6 +60,23 @@ namespace embree
     /*! invokes the memory monitor callback */
     void memoryMonitor(ssize_t bytes, bool post);
 
+    /*! classes of OS allocations with separate huge page thresholds */
+    enum MemoryClass { MEMORY_ACCEL = 0, MEMORY_BUILD = 1 };
+
+    /*! maps memory directly from the OS using the huge page policy of
+     *  the device, acceleration structure memory only gets reserved
+     *  and has to get committed, mode returns the applied policy */
+    void* osMalloc(size_t bytes, MemoryClass mclass, HugePageMode& mode);
+
+    /*! unmaps memory mapped with osMalloc */
+    void osFree(void* ptr, size_t bytes, HugePageMode mode);
+
+    /*! allocates large build arrays directly from the OS */
+    void* osMallocArray(size_t bytes);
+
+    /*! frees build arrays allocated with osMallocArray */
+    bool osFreeArray(void* ptr, size_t bytes);
+
     /*! sets the size of the software cache. */
     void setCacheSize(size_t bytes);
 
@@ -98,5 +116,16 @@ namespace embree
     
     /* ray streams filter */
     RayStreamFilterFuncs rayStreamFilters;
+
+    /* huge page policy */
+    HugePageMode hugePageMode;             //!< huge page mode for large OS allocations
+    size_t hugePageMinBytes[2];            //!< minimal size of an allocation of some MemoryClass to use huge pages, 0 disables OS allocations of build arrays
+    std::atomic<size_t> hugePageBytes;     //!< bytes currently mapped from the hugetlbfs pool
+    std::atomic<size_t> hugePageAdvisedBytes; //!< bytes currently advised to use transparent huge pages
+    SpinLock buildArraysMutex;
+    std::map<void*,HugePageMode> buildArrays; //!< build arrays allocated with osMallocArray
+
+    /* memory blocks kept mapped across commits */
+    MemoryRecycler recycler;
   };
 }
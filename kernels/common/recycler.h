@@ -0,0 +1,125 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "default.h"
+
+namespace embree
+{
+  /*! Keeps memory blocks released by the fast allocators of a device
+   *  mapped, such that later builds reuse already faulted in pages
+   *  instead of unmapping and mapping memory again. At most maxBytes
+   *  get kept, the default of 0 disables recycling. */
+  class MemoryRecycler
+  {
+    struct Item
+    {
+      Item (void* ptr, size_t bytes, HugePageMode mode) : ptr(ptr), bytes(bytes), mode(mode) {}
+      void* ptr;
+      size_t bytes;
+      HugePageMode mode;
+    };
+
+  public:
+
+    /*! function that finally frees blocks */
+    typedef std::function<void(void* ptr, size_t bytes, HugePageMode mode)> FreeFunc;
+
+    MemoryRecycler (const FreeFunc& freeFunc)
+      : freeFunc(freeFunc), maxBytes(0), bytesCached(0), numRecycled(0) {}
+
+    ~MemoryRecycler () {
+      setMaxBytes(0);
+    }
+
+    /*! sets the high-water mark, frees cached blocks exceeding it */
+    void setMaxBytes(size_t bytes)
+    {
+      Lock<SpinLock> lock(mutex);
+      maxBytes = bytes;
+      while (bytesCached > maxBytes)
+      {
+        /* free largest blocks first */
+        Item item = items.back(); items.pop_back();
+        bytesCached -= item.bytes;
+        freeFunc(item.ptr,item.bytes,item.mode);
+      }
+    }
+
+    /*! returns the high-water mark */
+    size_t getMaxBytes() const {
+      return maxBytes;
+    }
+
+    /*! returns the number of bytes of all cached blocks */
+    size_t getCachedBytes() const {
+      return bytesCached;
+    }
+
+    /*! returns how many blocks got reused */
+    size_t getNumRecycled() const {
+      return numRecycled;
+    }
+
+    /*! returns the smallest cached block that has at least the
+     *  requested size, bytes and mode get set to the size and huge
+     *  page policy of the block, returns nullptr if no block fits */
+    void* take(size_t& bytes, HugePageMode& mode)
+    {
+      if (maxBytes == 0) return nullptr;
+      Lock<SpinLock> lock(mutex);
+      for (size_t i=0; i<items.size(); i++)
+      {
+        /* do not waste more than half of a block */
+        if (items[i].bytes < bytes) continue;
+        if (items[i].bytes > 2*bytes) break;
+        Item item = items[i];
+        items.erase(items.begin()+i);
+        bytesCached -= item.bytes;
+        numRecycled++;
+        bytes = item.bytes;
+        mode = item.mode;
+        return item.ptr;
+      }
+      return nullptr;
+    }
+
+    /*! caches a block of memory allocated with os_malloc, returns false
+     *  if this would exceed the high-water mark */
+    bool give(void* ptr, size_t bytes, HugePageMode mode)
+    {
+      if (maxBytes == 0) return false;
+      Lock<SpinLock> lock(mutex);
+      if (bytesCached+bytes > maxBytes) return false;
+
+      /* keep blocks sorted by size */
+      size_t i = 0;
+      while (i<items.size() && items[i].bytes < bytes) i++;
+      items.insert(items.begin()+i,Item(ptr,bytes,mode));
+      bytesCached += bytes;
+      return true;
+    }
+
+  private:
+    FreeFunc freeFunc;
+    SpinLock mutex;
+    std::vector<Item> items;          //!< cached blocks sorted by size
+    std::atomic<size_t> maxBytes;     //!< high-water mark of the cached memory
+    std::atomic<size_t> bytesCached;  //!< bytes of all cached blocks
+    std::atomic<size_t> numRecycled;  //!< number of blocks that got reused
+  };
+}
@@ -250,6 +250,60 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcCommitWithPriority (RTCScene hscene, RTCCommitPriority priority) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitWithPriority);
+    RTCORE_VERIFY_HANDLE(hscene);
+    if (priority < RTC_COMMIT_PRIORITY_LOW || priority > RTC_COMMIT_PRIORITY_HIGH)
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid commit priority");
+    scene->commit(0,0,true,(TaskScheduler::Priority)priority);
+    RTCORE_CATCH_END(scene->device);
+  }
+
+  RTCORE_API bool rtcCommitTimeSliced (RTCScene hscene, unsigned int milliseconds) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitTimeSliced);
+    RTCORE_VERIFY_HANDLE(hscene);
+    return scene->commitTimeSliced(1E-3*double(milliseconds));
+    RTCORE_CATCH_END(scene->device);
+    return false;
+  }
+
+  RTCORE_API void rtcCancelCommit (RTCScene hscene) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCancelCommit);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->cancelCommit();
+    RTCORE_CATCH_END(scene->device);
+  }
+
+  RTCORE_API void rtcCommitAsync (RTCScene hscene) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitAsync);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->commitAsync();
+    RTCORE_CATCH_END(scene->device);
+  }
+
+  RTCORE_API bool rtcCommitAsyncFinish (RTCScene hscene, bool wait) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitAsyncFinish);
+    RTCORE_VERIFY_HANDLE(hscene);
+    return scene->finishAsyncCommit(wait);
+    RTCORE_CATCH_END(scene->device);
+    return false;
+  }
+
   RTCORE_API void rtcCommitJoin (RTCScene hscene) 
   {
     Scene* scene = (Scene*) hscene;
@@ -327,6 +381,23 @@ namespace embree
     bounds_o[1].align1  = 0;
     RTCORE_CATCH_END(scene->device);
   }
+
+  RTCORE_API size_t rtcGetMemoryStatistics(RTCScene hscene, RTCAccelMemoryStatistics* stats, size_t maxCount)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcGetMemoryStatistics);
+    RTCORE_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_INVALID_OPERATION,"scene got not committed");
+    if (maxCount && !stats) throw_RTCError(RTC_INVALID_ARGUMENT,"invalid statistics array");
+    std::vector<RTCAccelMemoryStatistics> accelStats;
+    scene->accels.getMemoryStatistics(accelStats);
+    for (size_t i=0; i<min(maxCount,accelStats.size()); i++)
+      stats[i] = accelStats[i];
+    return accelStats.size();
+    RTCORE_CATCH_END(scene->device);
+    return 0;
+  }
   
   RTCORE_API void rtcIntersect (RTCScene hscene, RTCRay& ray) 
   {
@@ -1221,7 +1292,7 @@ namespace embree
     RTCORE_TRACE(rtcNewLineSegments);
     RTCORE_VERIFY_HANDLE(hscene);
 #if defined(EMBREE_GEOMETRY_LINES)
-    return scene->newLineSegments(flags,numSegments,numVertices,numTimeSteps);
+    return scene->newLineSegments(LineSegments::FLAT,flags,numSegments,numVertices,numTimeSteps);
 #else
     throw_RTCError(RTC_UNKNOWN_ERROR,"rtcNewLineSegments is not supported");
 #endif
@@ -1229,6 +1300,66 @@ namespace embree
     return -1;
   }
 
+  RTCORE_API unsigned rtcNewRoundLineSegments (RTCScene hscene, RTCGeometryFlags flags, size_t numSegments, size_t numVertices, size_t numTimeSteps)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcNewRoundLineSegments);
+    RTCORE_VERIFY_HANDLE(hscene);
+#if defined(EMBREE_GEOMETRY_LINES)
+    return scene->newLineSegments(LineSegments::ROUND,flags,numSegments,numVertices,numTimeSteps);
+#else
+    throw_RTCError(RTC_UNKNOWN_ERROR,"rtcNewRoundLineSegments is not supported");
+#endif
+    RTCORE_CATCH_END(scene->device);
+    return -1;
+  }
+
+  RTCORE_API unsigned rtcNewSpherePoints (RTCScene hscene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcNewSpherePoints);
+    RTCORE_VERIFY_HANDLE(hscene);
+#if defined(EMBREE_GEOMETRY_POINTS)
+    return scene->newPoints(Points::SPHERE,flags,numPoints,numTimeSteps);
+#else
+    throw_RTCError(RTC_UNKNOWN_ERROR,"rtcNewSpherePoints is not supported");
+#endif
+    RTCORE_CATCH_END(scene->device);
+    return -1;
+  }
+
+  RTCORE_API unsigned rtcNewDiscPoints (RTCScene hscene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcNewDiscPoints);
+    RTCORE_VERIFY_HANDLE(hscene);
+#if defined(EMBREE_GEOMETRY_POINTS)
+    return scene->newPoints(Points::DISC,flags,numPoints,numTimeSteps);
+#else
+    throw_RTCError(RTC_UNKNOWN_ERROR,"rtcNewDiscPoints is not supported");
+#endif
+    RTCORE_CATCH_END(scene->device);
+    return -1;
+  }
+
+  RTCORE_API unsigned rtcNewOrientedDiscPoints (RTCScene hscene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcNewOrientedDiscPoints);
+    RTCORE_VERIFY_HANDLE(hscene);
+#if defined(EMBREE_GEOMETRY_POINTS)
+    return scene->newPoints(Points::ORIENTED_DISC,flags,numPoints,numTimeSteps);
+#else
+    throw_RTCError(RTC_UNKNOWN_ERROR,"rtcNewOrientedDiscPoints is not supported");
+#endif
+    RTCORE_CATCH_END(scene->device);
+    return -1;
+  }
+
   RTCORE_API unsigned rtcNewSubdivisionMesh (RTCScene hscene, RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, 
                                              size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles, size_t numTimeSteps) 
   {
@@ -1400,6 +1531,17 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcSetTessellationCamera (RTCScene hscene, unsigned geomID, const RTCTessellationCamera* camera)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetTessellationCamera);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setTessellationCamera(camera);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcSetUserData (RTCScene hscene, unsigned geomID, void* ptr) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1544,6 +1686,17 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+RTCORE_API void rtcSetIntersectFunctionNM (RTCScene hscene, unsigned geomID, RTCIntersectFuncNM intersect) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetIntersectFunctionNM);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setIntersectFunctionNM(intersect);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcSetOccludedFunction (RTCScene hscene, unsigned geomID, RTCOccludedFunc occluded) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1610,6 +1763,17 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+RTCORE_API void rtcSetOccludedFunctionNM (RTCScene hscene, unsigned geomID, RTCOccludedFuncNM occluded) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetOccludedFunctionNM);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setOccludedFunctionNM(occluded);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcSetIntersectionFilterFunction (RTCScene hscene, unsigned geomID, RTCFilterFunc intersect) 
   {
     Scene* scene = (Scene*) hscene;
@@ -36,7 +36,9 @@ namespace embree
     struct BVH
     {
       BVH (Device* device)
-        : device(device), isStatic(false), allocator(device,true), morton_src(device), morton_tmp(device) {}
+        : device(device), isStatic(false), allocator(device,true), morton_src(device), morton_tmp(device), mblur_prims(device), mblur_sorted(device),
+          flatChildren(device), flatBounds(device), flatLeafBegin(device), flatLeafSize(device), 
+          flatRoot(RTC_FLAT_BVH_EMPTY), flatBranchingFactor(0), flatNumPrimitives(0), flatRefitable(false) {}
 
     public:
       Device* device;
@@ -44,6 +46,105 @@ namespace embree
       FastAllocator allocator;
       mvector<BVHBuilderMorton::BuildPrim> morton_src;
       mvector<BVHBuilderMorton::BuildPrim> morton_tmp;
+
+      /* temporary arrays of rtcBuildBVHMB */
+      mvector<PrimRef> mblur_prims;
+      mvector<RTCBuildPrimitiveMB> mblur_sorted;
+
+      /* output arrays of rtcBuildBVHFlat */
+      mvector<unsigned> flatChildren;
+      mvector<float> flatBounds;
+      mvector<unsigned> flatLeafBegin;
+      mvector<unsigned> flatLeafSize;
+      unsigned flatRoot;           //!< root of the flat BVH
+      size_t flatBranchingFactor;  //!< number of child slots of each inner node of the flat BVH
+      size_t flatNumPrimitives;    //!< number of primitives the flat BVH got built over
+      bool flatRefitable;          //!< true if the last build was a flat build without spatial splits
+    };
+
+    /* forwards node and leaf creation to the user callbacks */
+    struct UserCallbacks
+    {
+      UserCallbacks (RTCCreateNodeFunc createNodeFunc, RTCSetNodeChildrenFunc setNodeChildrenFunc, RTCSetNodeBoundsFunc setNodeBoundsFunc, RTCCreateLeafFunc createLeafFunc, void* userPtr)
+        : createNodeFunc(createNodeFunc), setNodeChildrenFunc(setNodeChildrenFunc), setNodeBoundsFunc(setNodeBoundsFunc), createLeafFunc(createLeafFunc), userPtr(userPtr) {}
+
+      __forceinline void* createNode(FastAllocator::ThreadLocal* alloc, size_t N) const {
+        return createNodeFunc((RTCThreadLocalAllocator)alloc,N,userPtr);
+      }
+
+      __forceinline void setNodeBounds(void* node, const RTCBounds** bounds, size_t N) const {
+        setNodeBoundsFunc(node,bounds,N,userPtr);
+      }
+
+      __forceinline void setNodeChildren(void* node, void** children, size_t N) const {
+        setNodeChildrenFunc(node,children,N,userPtr);
+      }
+
+      __forceinline void* createLeaf(FastAllocator::ThreadLocal* alloc, RTCBuildPrimitive* prims, size_t begin, size_t N) const {
+        return createLeafFunc((RTCThreadLocalAllocator)alloc,prims+begin,N,userPtr);
+      }
+
+      RTCCreateNodeFunc createNodeFunc;
+      RTCSetNodeChildrenFunc setNodeChildrenFunc;
+      RTCSetNodeBoundsFunc setNodeBoundsFunc;
+      RTCCreateLeafFunc createLeafFunc;
+      void* userPtr;
+    };
+
+    /* writes nodes and leaves into the flat arrays of the BVH, node
+     * and leaf references get passed through the builders as pointers
+     * offset by one to never pass nullptr */
+    struct FlatCallbacks
+    {
+      FlatCallbacks (BVH* bvh, size_t branchingFactor)
+        : bvh(bvh), N(branchingFactor), numNodes(0), numLeaves(0) {}
+
+      static __forceinline void* encode(unsigned ref) { return (void*)(size_t(ref)+1); }
+      static __forceinline unsigned decode(void* ptr) { return unsigned(size_t(ptr)-1); }
+
+      __forceinline void* createNode(FastAllocator::ThreadLocal* alloc, size_t numChildren) {
+        return encode(numNodes++);
+      }
+
+      __forceinline void setNodeBounds(void* node, const RTCBounds** bounds, size_t numChildren) const 
+      {
+        const size_t numSlots = bvh->flatChildren.size();
+        float* lower_x = bvh->flatBounds.data()+0*numSlots, *upper_x = bvh->flatBounds.data()+3*numSlots;
+        float* lower_y = bvh->flatBounds.data()+1*numSlots, *upper_y = bvh->flatBounds.data()+4*numSlots;
+        float* lower_z = bvh->flatBounds.data()+2*numSlots, *upper_z = bvh->flatBounds.data()+5*numSlots;
+        const size_t slot = decode(node)*N;
+        for (size_t i=0; i<N; i++) 
+        {
+          if (i < numChildren) {
+            lower_x[slot+i] = bounds[i]->lower_x; upper_x[slot+i] = bounds[i]->upper_x;
+            lower_y[slot+i] = bounds[i]->lower_y; upper_y[slot+i] = bounds[i]->upper_y;
+            lower_z[slot+i] = bounds[i]->lower_z; upper_z[slot+i] = bounds[i]->upper_z;
+          } else {
+            lower_x[slot+i] = lower_y[slot+i] = lower_z[slot+i] = pos_inf;
+            upper_x[slot+i] = upper_y[slot+i] = upper_z[slot+i] = neg_inf;
+          }
+        }
+      }
+
+      __forceinline void setNodeChildren(void* node, void** children, size_t numChildren) const 
+      {
+        const size_t slot = decode(node)*N;
+        for (size_t i=0; i<N; i++) 
+          bvh->flatChildren[slot+i] = i < numChildren ? decode(children[i]) : RTC_FLAT_BVH_EMPTY;
+      }
+
+      __forceinline void* createLeaf(FastAllocator::ThreadLocal* alloc, RTCBuildPrimitive* prims, size_t begin, size_t numPrims) 
+      {
+        const unsigned leaf = numLeaves++;
+        bvh->flatLeafBegin[leaf] = unsigned(begin);
+        bvh->flatLeafSize [leaf] = unsigned(numPrims);
+        return encode(leaf | RTC_FLAT_BVH_LEAF);
+      }
+
+      BVH* bvh;
+      const size_t N;
+      std::atomic<unsigned> numNodes;
+      std::atomic<unsigned> numLeaves;
     };
 
     RTCORE_API RTCBVH rtcNewBVH(RTCDevice device)
@@ -56,14 +157,12 @@ namespace embree
       return nullptr;
     }
 
+    template<typename Callbacks>
     void* rtcBuildBVHMorton(BVH* bvh,
                             const RTCBuildSettings& settings,
                             RTCBuildPrimitive* prims_i,
                             size_t numPrimitives,
-                            RTCCreateNodeFunc createNode,
-                            RTCSetNodeChildrenFunc setNodeChildren,
-                            RTCSetNodeBoundsFunc setNodeBounds,
-                            RTCCreateLeafFunc createLeaf,
+                            Callbacks& callbacks,
                             RTCBuildProgressFunc buildProgress,
                             void* userPtr)
     {
@@ -102,7 +201,7 @@ namespace embree
         
         /* lambda function that allocates BVH nodes */
         [&] ( FastAllocator::ThreadLocal* alloc, size_t N ) -> void* {
-          return createNode((RTCThreadLocalAllocator)alloc,N,userPtr);
+          return callbacks.createNode(alloc,N);
         },
         
         /* lambda function that sets bounds */
@@ -116,17 +215,18 @@ namespace embree
             childptrs[i] = children[i].first;
             cbounds[i] = (const RTCBounds*)&children[i].second;
           }
-          setNodeBounds(node,cbounds,N,userPtr);
-          setNodeChildren(node,childptrs,N,userPtr);
+          callbacks.setNodeBounds(node,cbounds,N);
+          callbacks.setNodeChildren(node,childptrs,N);
           return std::make_pair(node,bounds);
         },
         
         /* lambda function that creates BVH leaves */
         [&]( const range<unsigned>& current, FastAllocator::ThreadLocal* alloc) -> std::pair<void*,BBox3fa>
         {
-          const size_t id = morton_src[current.begin()].index;
-          const BBox3fa bounds = prims[id].bounds(); 
-          void* node = createLeaf((RTCThreadLocalAllocator)alloc,prims_i+current.begin(),current.size(),userPtr);
+          BBox3fa bounds = empty;
+          for (size_t i=current.begin(); i<current.end(); i++)
+            bounds.extend(prims[morton_src[i].index].bounds());
+          void* node = callbacks.createLeaf(alloc,prims_i,current.begin(),current.size());
           return std::make_pair(node,bounds);
         },
         
@@ -147,14 +247,12 @@ namespace embree
       return root.first;
     }
 
+    template<typename Callbacks>
     void* rtcBuildBVHBinnedSAH(BVH* bvh,
                                const RTCBuildSettings& settings,
                                RTCBuildPrimitive* prims,
                                size_t numPrimitives,
-                               RTCCreateNodeFunc createNode,
-                               RTCSetNodeChildrenFunc setNodeChildren,
-                               RTCSetNodeBoundsFunc setNodeBounds,
-                               RTCCreateLeafFunc createLeaf,
+                               Callbacks& callbacks,
                                RTCBuildProgressFunc buildProgress,
                                void* userPtr)
     {
@@ -182,22 +280,22 @@ namespace embree
         /* lambda function that creates BVH nodes */
         [&](BVHBuilderBinnedSAH::BuildRecord* children, const size_t N, FastAllocator::ThreadLocal* alloc) -> void*
         {
-          void* node = createNode((RTCThreadLocalAllocator)alloc,N,userPtr);
+          void* node = callbacks.createNode(alloc,N);
           const RTCBounds* cbounds[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
           for (size_t i=0; i<N; i++) cbounds[i] = (const RTCBounds*) &children[i].prims.geomBounds;
-          setNodeBounds(node,cbounds,N,userPtr);
+          callbacks.setNodeBounds(node,cbounds,N);
           return node;
         },
 
         /* lambda function that updates BVH nodes */
         [&](const BVHBuilderBinnedSAH::BuildRecord& precord, const BVHBuilderBinnedSAH::BuildRecord* crecords, void* node, void** children, const size_t N) -> void* {
-          setNodeChildren(node,children,N,userPtr);
+          callbacks.setNodeChildren(node,children,N);
           return node;
         },
         
         /* lambda function that creates BVH leaves */
         [&](const BVHBuilderBinnedSAH::BuildRecord& current, FastAllocator::ThreadLocal* alloc) -> void* {
-          return createLeaf((RTCThreadLocalAllocator)alloc,prims+current.prims.begin(),current.prims.size(),userPtr);
+          return callbacks.createLeaf(alloc,prims,current.prims.begin(),current.prims.size());
         },
         
         /* progress monitor function */
@@ -211,14 +309,12 @@ namespace embree
       return root;
     }
 
-     void* rtcBuildBVHSpatialSAH(BVH* bvh,
+    template<typename Callbacks>
+    void* rtcBuildBVHSpatialSAH(BVH* bvh,
                                  const RTCBuildSettings& settings,
                                  RTCBuildPrimitive* prims,
                                  size_t numPrimitives,
-                                 RTCCreateNodeFunc createNode,
-                                 RTCSetNodeChildrenFunc setNodeChildren,
-                                 RTCSetNodeBoundsFunc setNodeBounds,
-                                 RTCCreateLeafFunc createLeaf,
+                                 Callbacks& callbacks,
                                  RTCSplitPrimitiveFunc splitPrimitive,
                                  RTCBuildProgressFunc buildProgress,
                                  void* userPtr)
@@ -273,22 +369,22 @@ namespace embree
         /* lambda function that creates BVH nodes */
         [&] (BVHBuilderBinnedFastSpatialSAH::BuildRecord* children, const size_t N, FastAllocator::ThreadLocal* alloc) -> void*
         {
-          void* node = createNode((RTCThreadLocalAllocator)alloc,N,userPtr);
+          void* node = callbacks.createNode(alloc,N);
           const RTCBounds* cbounds[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
           for (size_t i=0; i<N; i++) cbounds[i] = (const RTCBounds*) &children[i].prims.geomBounds;
-          setNodeBounds(node,cbounds,N,userPtr);
+          callbacks.setNodeBounds(node,cbounds,N);
           return node;
         },
 
         /* lambda function that updates BVH nodes */
         [&] (const BVHBuilderBinnedFastSpatialSAH::BuildRecord& precord, const BVHBuilderBinnedFastSpatialSAH::BuildRecord* crecords, void* node, void** children, const size_t N) -> void* {
-          setNodeChildren(node,children,N,userPtr);
+          callbacks.setNodeChildren(node,children,N);
           return node;
         },
         
         /* lambda function that creates BVH leaves */
         [&] (const BVHBuilderBinnedFastSpatialSAH::BuildRecord& current, FastAllocator::ThreadLocal* alloc) -> void* {
-          return createLeaf((RTCThreadLocalAllocator)alloc,prims+current.prims.begin(),current.prims.size(),userPtr);
+          return callbacks.createLeaf(alloc,prims,current.prims.begin(),current.prims.size());
         },
         
         /* returns the splitter */
@@ -309,6 +405,40 @@ namespace embree
       return root;
     }
 
+    template<typename Callbacks>
+    void* rtcBuildBVHQuality(BVH* bvh,
+                             const RTCBuildSettings& settings,
+                             RTCBuildPrimitive* prims,
+                             size_t numPrimitives,
+                             Callbacks& callbacks,
+                             RTCSplitPrimitiveFunc splitPrimitive,
+                             RTCBuildProgressFunc buildProgress,
+                             void* userPtr)
+    {
+      /* if we made this BVH static, we can not re-build it anymore  */
+      if (bvh->isStatic)
+        throw_RTCError(RTC_INVALID_OPERATION,"static BVH cannot get rebuild");
+
+      /* initialize the allocator */
+      bvh->allocator.init_estimate(numPrimitives*sizeof(BBox3fa));
+      bvh->allocator.reset();
+
+      /* switch between differnet builders based on quality level */
+      if (settings.quality == RTC_BUILD_QUALITY_LOW)
+        return rtcBuildBVHMorton   (bvh,settings,prims,numPrimitives,callbacks,buildProgress,userPtr);
+      else if (settings.quality == RTC_BUILD_QUALITY_NORMAL)
+        return rtcBuildBVHBinnedSAH(bvh,settings,prims,numPrimitives,callbacks,buildProgress,userPtr);
+      else if (settings.quality == RTC_BUILD_QUALITY_HIGH) {
+        if (splitPrimitive == nullptr || settings.extraSpace == 0)
+          return rtcBuildBVHBinnedSAH(bvh,settings,prims,numPrimitives,callbacks,buildProgress,userPtr);
+        else
+          return rtcBuildBVHSpatialSAH(bvh,settings,prims,numPrimitives,callbacks,splitPrimitive,buildProgress,userPtr);  
+      }
+      else
+        throw_RTCError(RTC_INVALID_OPERATION,"invalid build quality");
+      return nullptr;
+    }
+
     RTCORE_API void* rtcBuildBVH(RTCBVH hbvh,
                                  const RTCBuildSettings& settings,
                                  RTCBuildPrimitive* prims,
@@ -329,33 +459,257 @@ namespace embree
       RTCORE_VERIFY_HANDLE(setNodeChildren);
       RTCORE_VERIFY_HANDLE(setNodeBounds);
       RTCORE_VERIFY_HANDLE(createLeaf);
+      bvh->flatRefitable = false;
+
+      UserCallbacks callbacks(createNode,setNodeChildren,setNodeBounds,createLeaf,userPtr);
+      return rtcBuildBVHQuality(bvh,settings,prims,numPrimitives,callbacks,splitPrimitive,buildProgress,userPtr);
+
+      RTCORE_CATCH_END(bvh->device);
+      return nullptr;
+    }
+
+    /* returns the linear bounds of a motion blurred build primitive */
+    __forceinline LBBox3fa linearBounds(const RTCBuildPrimitiveMB& prim) 
+    {
+      const BBox3fa bounds0(Vec3fa(prim.lower0_x,prim.lower0_y,prim.lower0_z),Vec3fa(prim.upper0_x,prim.upper0_y,prim.upper0_z));
+      const BBox3fa bounds1(Vec3fa(prim.lower1_x,prim.lower1_y,prim.lower1_z),Vec3fa(prim.upper1_x,prim.upper1_y,prim.upper1_z));
+      return LBBox3fa(bounds0,bounds1);
+    }
+
+    RTCORE_API void* rtcBuildBVHMB(RTCBVH hbvh,
+                                   const RTCBuildSettings& settings,
+                                   RTCBuildPrimitiveMB* prims_i,
+                                   size_t numPrimitives,
+                                   RTCCreateNodeFunc createNode,
+                                   RTCSetNodeChildrenFunc setNodeChildren,
+                                   RTCSetNodeBoundsMBFunc setNodeBounds,
+                                   RTCCreateLeafMBFunc createLeaf,
+                                   RTCBuildProgressFunc buildProgress,
+                                   void* userPtr)
+    {
+      BVH* bvh = (BVH*) hbvh;
+      RTCORE_CATCH_BEGIN;
+      RTCORE_TRACE(rtcBuildBVHMB);
+      RTCORE_VERIFY_HANDLE(hbvh);
+      RTCORE_VERIFY_HANDLE(createNode);
+      RTCORE_VERIFY_HANDLE(setNodeChildren);
+      RTCORE_VERIFY_HANDLE(setNodeBounds);
+      RTCORE_VERIFY_HANDLE(createLeaf);
 
       /* if we made this BVH static, we can not re-build it anymore  */
       if (bvh->isStatic)
         throw_RTCError(RTC_INVALID_OPERATION,"static BVH cannot get rebuild");
+      bvh->flatRefitable = false;
 
       /* initialize the allocator */
-      bvh->allocator.init_estimate(numPrimitives*sizeof(BBox3fa));
+      bvh->allocator.init_estimate(numPrimitives*sizeof(LBBox3fa));
       bvh->allocator.reset();
 
-      /* switch between differnet builders based on quality level */
-      if (settings.quality == RTC_BUILD_QUALITY_LOW)
-        return rtcBuildBVHMorton   (bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,buildProgress,userPtr);
-      else if (settings.quality == RTC_BUILD_QUALITY_NORMAL)
-        return rtcBuildBVHBinnedSAH(bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,buildProgress,userPtr);
-      else if (settings.quality == RTC_BUILD_QUALITY_HIGH) {
-        if (splitPrimitive == nullptr || settings.extraSpace == 0)
-          return rtcBuildBVHBinnedSAH(bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,buildProgress,userPtr);
-        else
-          return rtcBuildBVHSpatialSAH(bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,splitPrimitive,buildProgress,userPtr);  
-      }
-      else
-        throw_RTCError(RTC_INVALID_OPERATION,"invalid build quality");
+      /* like the internal motion blur builders we bin the bounds over the entire time range */
+      mvector<PrimRef>& prims = bvh->mblur_prims;
+      mvector<RTCBuildPrimitiveMB>& sorted = bvh->mblur_sorted;
+      prims.resize(numPrimitives);
+      sorted.resize(numPrimitives);
+      auto computeBounds = [&](const range<size_t>& r) -> CentGeomBBox3fa
+        {
+          CentGeomBBox3fa bounds(empty);
+          for (size_t j=r.begin(); j<r.end(); j++) {
+            prims[j] = PrimRef(linearBounds(prims_i[j]).bounds(),j);
+            bounds.extend(prims[j].bounds());
+          }
+          return bounds;
+        };
+      const CentGeomBBox3fa bounds = 
+        parallel_reduce(size_t(0),numPrimitives,size_t(1024),size_t(1024),CentGeomBBox3fa(empty), computeBounds, CentGeomBBox3fa::merge2);
+
+      const PrimInfo pinfo(0,numPrimitives,bounds.geomBounds,bounds.centBounds);
+
+      /* build BVH and propagate linear bounds bottom up */
+      std::pair<void*,LBBox3fa> root = BVHBuilderBinnedSAH::build<std::pair<void*,LBBox3fa>>(
+        
+        /* thread local allocator for fast allocations */
+        [&] () -> FastAllocator::ThreadLocal* { 
+          return bvh->allocator.threadLocal();
+        },
+
+        /* lambda function that creates BVH nodes */
+        [&](BVHBuilderBinnedSAH::BuildRecord* children, const size_t N, FastAllocator::ThreadLocal* alloc) -> void* {
+          return createNode((RTCThreadLocalAllocator)alloc,N,userPtr);
+        },
+
+        /* lambda function that sets linear bounds and children of BVH nodes */
+        [&](const BVHBuilderBinnedSAH::BuildRecord& precord, const BVHBuilderBinnedSAH::BuildRecord* crecords, void* node, std::pair<void*,LBBox3fa>* children, const size_t N) -> std::pair<void*,LBBox3fa> 
+        {
+          LBBox3fa bounds = empty;
+          void* childptrs[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+          const RTCBounds* cbounds0[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+          const RTCBounds* cbounds1[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+          for (size_t i=0; i<N; i++) {
+            bounds.extend(children[i].second);
+            childptrs[i] = children[i].first;
+            cbounds0[i] = (const RTCBounds*) &children[i].second.bounds0;
+            cbounds1[i] = (const RTCBounds*) &children[i].second.bounds1;
+          }
+          setNodeBounds(node,cbounds0,cbounds1,N,userPtr);
+          setNodeChildren(node,childptrs,N,userPtr);
+          return std::make_pair(node,bounds);
+        },
+        
+        /* lambda function that creates BVH leaves */
+        [&](const BVHBuilderBinnedSAH::BuildRecord& current, FastAllocator::ThreadLocal* alloc) -> std::pair<void*,LBBox3fa> 
+        {
+          LBBox3fa bounds = empty;
+          for (size_t i=current.prims.begin(); i<current.prims.end(); i++) {
+            sorted[i] = prims_i[prims[i].ID()];
+            bounds.extend(linearBounds(sorted[i]));
+          }
+          void* node = createLeaf((RTCThreadLocalAllocator)alloc,&sorted[current.prims.begin()],current.prims.size(),userPtr);
+          return std::make_pair(node,bounds);
+        },
+        
+        /* progress monitor function */
+        [&] (size_t dn) { 
+          if (buildProgress) buildProgress(dn,userPtr);
+        },
+        
+        prims.data(),pinfo,settings);
+
+      /* store primitives in leaf order */
+      parallel_for(size_t(0), numPrimitives, [&](const range<size_t>& r) {
+          for (size_t i=r.begin(); i<r.end(); i++) prims_i[i] = sorted[i];
+        });
+        
+      bvh->allocator.cleanup();
+      return root.first;
 
       RTCORE_CATCH_END(bvh->device);
       return nullptr;
     }
 
+    RTCORE_API void rtcBuildBVHFlat(RTCBVH hbvh,
+                                    const RTCBuildSettings& settings,
+                                    RTCBuildPrimitive* prims,
+                                    size_t numPrimitives,
+                                    RTCSplitPrimitiveFunc splitPrimitive,
+                                    RTCBuildProgressFunc buildProgress,
+                                    void* userPtr,
+                                    RTCFlatBVH& flat_o)
+    {
+      BVH* bvh = (BVH*) hbvh;
+      RTCORE_CATCH_BEGIN;
+      RTCORE_TRACE(rtcBuildBVHFlat);
+      RTCORE_VERIFY_HANDLE(hbvh);
+      if (settings.maxBranchingFactor < 2 || settings.maxBranchingFactor > GeneralBVHBuilder::MAX_BRANCHING_FACTOR)
+        throw_RTCError(RTC_INVALID_ARGUMENT,"invalid branching factor");
+
+      /* a BVH with branching factor N >= 2 has less inner nodes than leaves and at most one leaf per primitive */
+      const bool spatialSplits = settings.quality == RTC_BUILD_QUALITY_HIGH && splitPrimitive && settings.extraSpace;
+      const size_t maxLeaves = max(size_t(1),numPrimitives + (spatialSplits ? settings.extraSpace : 0));
+      if (maxLeaves >= RTC_FLAT_BVH_LEAF)
+        throw_RTCError(RTC_INVALID_ARGUMENT,"too many primitives for flat BVH");
+      const size_t N = settings.maxBranchingFactor;
+      bvh->flatRefitable = false;
+      bvh->flatChildren.resize(maxLeaves*N);
+      bvh->flatBounds.resize(6*maxLeaves*N);
+      bvh->flatLeafBegin.resize(maxLeaves);
+      bvh->flatLeafSize.resize(maxLeaves);
+
+      FlatCallbacks callbacks(bvh,N);
+      void* root = rtcBuildBVHQuality(bvh,settings,prims,numPrimitives,callbacks,splitPrimitive,buildProgress,userPtr);
+
+      /* leaves of the morton builder reference primitives in morton code order */
+      if (settings.quality == RTC_BUILD_QUALITY_LOW) 
+      {
+        avector<RTCBuildPrimitive> sorted(numPrimitives);
+        parallel_for(size_t(0), numPrimitives, [&](const range<size_t>& r) {
+            for (size_t i=r.begin(); i<r.end(); i++) sorted[i] = prims[bvh->morton_src[i].index];
+          });
+        parallel_for(size_t(0), numPrimitives, [&](const range<size_t>& r) {
+            for (size_t i=r.begin(); i<r.end(); i++) prims[i] = sorted[i];
+          });
+      }
+
+      bvh->flatRoot = root ? FlatCallbacks::decode(root) : RTC_FLAT_BVH_EMPTY;
+      bvh->flatBranchingFactor = N;
+      bvh->flatNumPrimitives = numPrimitives;
+      bvh->flatRefitable = !spatialSplits;
+
+      const size_t numSlots = bvh->flatChildren.size();
+      flat_o.root = bvh->flatRoot;
+      flat_o.branchingFactor = N;
+      flat_o.numNodes = callbacks.numNodes;
+      flat_o.numLeaves = callbacks.numLeaves;
+      flat_o.children = bvh->flatChildren.data();
+      flat_o.lower_x = bvh->flatBounds.data()+0*numSlots;
+      flat_o.lower_y = bvh->flatBounds.data()+1*numSlots;
+      flat_o.lower_z = bvh->flatBounds.data()+2*numSlots;
+      flat_o.upper_x = bvh->flatBounds.data()+3*numSlots;
+      flat_o.upper_y = bvh->flatBounds.data()+4*numSlots;
+      flat_o.upper_z = bvh->flatBounds.data()+5*numSlots;
+      flat_o.leafBegin = bvh->flatLeafBegin.data();
+      flat_o.leafSize = bvh->flatLeafSize.data();
+
+      RTCORE_CATCH_END(bvh->device);
+    }
+
+    /* recomputes the bounds of some subtree of a flat BVH, subtrees
+     * close to the root get refitted in parallel */
+    BBox3fa refitFlatBVH(BVH* bvh, const RTCBuildPrimitive* prims, unsigned ref, size_t depth)
+    {
+      if (ref & RTC_FLAT_BVH_LEAF) 
+      {
+        const unsigned leaf = ref & ~RTC_FLAT_BVH_LEAF;
+        const PrimRef* leafPrims = (const PrimRef*) prims + bvh->flatLeafBegin[leaf];
+        BBox3fa bounds = empty;
+        for (size_t i=0; i<bvh->flatLeafSize[leaf]; i++)
+          bounds.extend(leafPrims[i].bounds());
+        return bounds;
+      }
+
+      const size_t numSlots = bvh->flatChildren.size();
+      const size_t N = bvh->flatBranchingFactor;
+      const size_t slot = ref*N;
+      size_t numChildren = 0;
+      while (numChildren < N && bvh->flatChildren[slot+numChildren] != RTC_FLAT_BVH_EMPTY) numChildren++;
+
+      BBox3fa cbounds[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+      if (depth < 8) {
+        parallel_for(size_t(0), numChildren, [&](const range<size_t>& r) {
+            for (size_t i=r.begin(); i<r.end(); i++) 
+              cbounds[i] = refitFlatBVH(bvh,prims,bvh->flatChildren[slot+i],depth+1);
+          });
+      } else {
+        for (size_t i=0; i<numChildren; i++) 
+          cbounds[i] = refitFlatBVH(bvh,prims,bvh->flatChildren[slot+i],depth+1);
+      }
+
+      BBox3fa bounds = empty;
+      float* data = bvh->flatBounds.data();
+      for (size_t i=0; i<numChildren; i++) 
+      {
+        data[0*numSlots+slot+i] = cbounds[i].lower.x; data[3*numSlots+slot+i] = cbounds[i].upper.x;
+        data[1*numSlots+slot+i] = cbounds[i].lower.y; data[4*numSlots+slot+i] = cbounds[i].upper.y;
+        data[2*numSlots+slot+i] = cbounds[i].lower.z; data[5*numSlots+slot+i] = cbounds[i].upper.z;
+        bounds.extend(cbounds[i]);
+      }
+      return bounds;
+    }
+
+    RTCORE_API void rtcRefitBVH(RTCBVH hbvh, const RTCBuildPrimitive* prims, size_t numPrimitives)
+    {
+      BVH* bvh = (BVH*) hbvh;
+      RTCORE_CATCH_BEGIN;
+      RTCORE_TRACE(rtcRefitBVH);
+      RTCORE_VERIFY_HANDLE(hbvh);
+      if (!bvh->flatRefitable)
+        throw_RTCError(RTC_INVALID_OPERATION,"only BVHs built with rtcBuildBVHFlat without spatial splits can get refitted");
+      if (numPrimitives != bvh->flatNumPrimitives)
+        throw_RTCError(RTC_INVALID_ARGUMENT,"number of primitives changed");
+      if (bvh->flatRoot != RTC_FLAT_BVH_EMPTY)
+        refitFlatBVH(bvh,prims,bvh->flatRoot,0);
+      RTCORE_CATCH_END(bvh->device);
+    }
+
     RTCORE_API void* rtcThreadLocalAlloc(RTCThreadLocalAllocator localAllocator, size_t bytes, size_t align)
     {
       RTCORE_CATCH_BEGIN;
@@ -375,6 +729,8 @@ namespace embree
       bvh->allocator.shrink();
       bvh->morton_src.clear();
       bvh->morton_tmp.clear();
+      bvh->mblur_prims.clear();
+      bvh->mblur_sorted.clear();
       bvh->isStatic = true;
       RTCORE_CATCH_END(bvh->device);
     }
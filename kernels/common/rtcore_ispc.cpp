@@ -120,6 +120,26 @@ namespace embree
     return rtcCommit(scene);
   }
 
+  extern "C" void ispcCommitWithPriority (RTCScene scene, RTCCommitPriority priority) {
+    return rtcCommitWithPriority(scene,priority);
+  }
+
+  extern "C" bool ispcCommitTimeSliced (RTCScene scene, unsigned int milliseconds) {
+    return rtcCommitTimeSliced(scene,milliseconds);
+  }
+
+  extern "C" void ispcCancelCommit (RTCScene scene) {
+    return rtcCancelCommit(scene);
+  }
+
+  extern "C" void ispcCommitAsync (RTCScene scene) {
+    return rtcCommitAsync(scene);
+  }
+
+  extern "C" bool ispcCommitAsyncFinish (RTCScene scene, bool wait) {
+    return rtcCommitAsyncFinish(scene,wait);
+  }
+
   extern "C" void ispcCommitJoin (RTCScene scene) {
     return rtcCommitJoin(scene);
   }
@@ -244,6 +264,22 @@ namespace embree
     return rtcNewLineSegments(scene,flags,numSegments,numVertices,numTimeSteps);
   }
 
+  extern "C" unsigned ispcNewRoundLineSegments (RTCScene scene, RTCGeometryFlags flags, size_t numSegments, size_t numVertices, size_t numTimeSteps) {
+    return rtcNewRoundLineSegments(scene,flags,numSegments,numVertices,numTimeSteps);
+  }
+
+  extern "C" unsigned ispcNewSpherePoints (RTCScene scene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps) {
+    return rtcNewSpherePoints(scene,flags,numPoints,numTimeSteps);
+  }
+
+  extern "C" unsigned ispcNewDiscPoints (RTCScene scene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps) {
+    return rtcNewDiscPoints(scene,flags,numPoints,numTimeSteps);
+  }
+
+  extern "C" unsigned ispcNewOrientedDiscPoints (RTCScene scene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps) {
+    return rtcNewOrientedDiscPoints(scene,flags,numPoints,numTimeSteps);
+  }
+
   extern "C" unsigned ispcNewHairGeometry (RTCScene scene, RTCGeometryFlags flags, size_t numCurves, size_t numVertices, size_t numTimeSteps) {
     return rtcNewHairGeometry(scene,flags,numCurves,numVertices,numTimeSteps);
   }
@@ -309,6 +345,10 @@ namespace embree
   extern "C" void ispcSetTessellationRate (RTCScene hscene, unsigned geomID, float tessellationRate) {
     rtcSetTessellationRate(hscene,geomID,tessellationRate);
   }
+
+  extern "C" void ispcSetTessellationCamera (RTCScene hscene, unsigned geomID, const RTCTessellationCamera* camera) {
+    rtcSetTessellationCamera(hscene,geomID,camera);
+  }
     
   extern "C" void ispcSetUserData (RTCScene hscene, unsigned geomID, void* ptr) 
   {
@@ -411,6 +451,17 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+extern "C" void ispcSetIntersectFunctionNM (RTCScene hscene, unsigned geomID, RTCIntersectFuncNM intersect) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetIntersectFunctionNM);
+    RTCORE_VERIFY_HANDLE(scene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    ((Scene*)scene)->get_locked(geomID)->setIntersectFunctionNM(intersect);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   extern "C" void ispcSetOccludedFunction1 (RTCScene hscene, unsigned geomID, RTCOccludedFunc occluded) 
   {
     Scene* scene = (Scene*) hscene;
@@ -477,6 +528,17 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+extern "C" void ispcSetOccludedFunctionNM (RTCScene hscene, unsigned geomID, RTCOccludedFuncNM occluded) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetOccludedFunctionNM);
+    RTCORE_VERIFY_HANDLE(scene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    ((Scene*)scene)->get_locked(geomID)->setOccludedFunctionNM(occluded);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   extern "C" void ispcSetIntersectionFilterFunction1 (RTCScene hscene, unsigned geomID, RTCFilterFunc filter) 
   {
     Scene* scene = (Scene*) hscene;
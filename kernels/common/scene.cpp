@@ -39,9 +39,12 @@ namespace embree
       needQuadIndices(false), needQuadVertices(false), 
       needBezierIndices(false), needBezierVertices(false),
       needLineIndices(false), needLineVertices(false),
+      needPointVertices(false),
       needSubdivIndices(false), needSubdivVertices(false),
       is_build(false), modified(true),
       progressInterface(this), progress_monitor_function(nullptr), progress_monitor_ptr(nullptr), progress_monitor_counter(0), 
+      asyncAccels(nullptr), usesAsyncCommits(false), asyncThread(nullptr), asyncDone(false), asyncException(nullptr),
+      commitRunning(false), cancelNext(false), cancelRequested(false), timeSliceExpired(false), timeSliceEnd(inf), timeSliceScale(1.0),
       numIntersectionFilters1(0), numIntersectionFilters4(0), numIntersectionFilters8(0), numIntersectionFilters16(0), numIntersectionFiltersN(0)
   {
 #if defined(TASKING_INTERNAL) 
@@ -67,9 +70,15 @@ namespace embree
       needQuadVertices = true;      
       needBezierVertices = true;
       needLineVertices = true;
+      needPointVertices = true;
       needSubdivVertices = true;
     }
 
+    createAccels();
+  }
+
+  void Scene::createAccels()
+  {
     createTriangleAccel();
     createTriangleMBAccel();
     createQuadAccel();
@@ -80,6 +89,8 @@ namespace embree
     createHairMBAccel();
     createLineAccel();
     createLineMBAccel();
+    createPointAccel();
+    createPointMBAccel();
 
 #if defined(EMBREE_GEOMETRY_TRIANGLES)
     accels.add(device->bvh4_factory->BVH4InstancedBVH4Triangle4ObjectSplit(this));
@@ -381,11 +392,13 @@ namespace embree
     }
     else if (device->hair_accel == "bvh4.bezier1v"    ) accels.add(device->bvh4_factory->BVH4Bezier1v(this));
     else if (device->hair_accel == "bvh4.bezier1i"    ) accels.add(device->bvh4_factory->BVH4Bezier1i(this));
+    else if (device->hair_accel == "bvh4.bezier1s"    ) accels.add(device->bvh4_factory->BVH4Bezier1s(this));
     else if (device->hair_accel == "bvh4obb.bezier1v" ) accels.add(device->bvh4_factory->BVH4OBBBezier1v(this));
     else if (device->hair_accel == "bvh4obb.bezier1i" ) accels.add(device->bvh4_factory->BVH4OBBBezier1i(this));
 #if defined (__TARGET_AVX__)
     else if (device->hair_accel == "bvh8obb.bezier1v" ) accels.add(device->bvh8_factory->BVH8OBBBezier1v(this));
     else if (device->hair_accel == "bvh8obb.bezier1i" ) accels.add(device->bvh8_factory->BVH8OBBBezier1i(this));
+    else if (device->hair_accel == "bvh8obb.bezier8q" ) accels.add(device->bvh8_factory->BVH8OBBBezier8q(this));
 #endif
     else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown hair acceleration structure "+device->hair_accel);
 #endif
@@ -462,6 +475,46 @@ namespace embree
 #endif
   }
 
+  void Scene::createPointAccel()
+  {
+#if defined(EMBREE_GEOMETRY_POINTS)
+    if (device->point_accel == "default")
+    {
+#if defined (__TARGET_AVX__)
+      if (device->hasISA(AVX) && !isCompact())
+        accels.add(device->bvh8_factory->BVH8Point4i(this));
+      else
+#endif
+        accels.add(device->bvh4_factory->BVH4Point4i(this));
+    }
+    else if (device->point_accel == "bvh4.point4i") accels.add(device->bvh4_factory->BVH4Point4i(this));
+#if defined (__TARGET_AVX__)
+    else if (device->point_accel == "bvh8.point4i") accels.add(device->bvh8_factory->BVH8Point4i(this));
+#endif
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown point acceleration structure "+device->point_accel);
+#endif
+  }
+
+  void Scene::createPointMBAccel()
+  {
+#if defined(EMBREE_GEOMETRY_POINTS)
+    if (device->point_accel_mb == "default")
+    {
+#if defined (__TARGET_AVX__)
+      if (device->hasISA(AVX) && !isCompact())
+        accels.add(device->bvh8_factory->BVH8Point4iMB(this));
+      else
+#endif
+        accels.add(device->bvh4_factory->BVH4Point4iMB(this));
+    }
+    else if (device->point_accel_mb == "bvh4.point4imb") accels.add(device->bvh4_factory->BVH4Point4iMB(this));
+#if defined (__TARGET_AVX__)
+    else if (device->point_accel_mb == "bvh8.point4imb") accels.add(device->bvh8_factory->BVH8Point4iMB(this));
+#endif
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown motion blur point acceleration structure "+device->point_accel_mb);
+#endif
+  }
+
   void Scene::createSubdivAccel()
   {
 #if defined(EMBREE_GEOMETRY_SUBDIV)
@@ -520,9 +573,14 @@ namespace embree
   
   Scene::~Scene () 
   {
+    if (asyncThread) 
+      embree::join(asyncThread);
+    
     for (size_t i=0; i<geometries.size(); i++)
       delete geometries[i];
 
+    delete asyncAccels; asyncAccels = nullptr;
+
 #if defined(TASKING_TBB) || defined(TASKING_PPL)
     delete group; group = nullptr;
 #endif
@@ -652,7 +710,24 @@ namespace embree
 #endif
 
 #if defined(EMBREE_GEOMETRY_LINES)
-  unsigned Scene::newLineSegments (RTCGeometryFlags gflags, size_t numSegments, size_t numVertices, size_t numTimeSteps)
+  unsigned Scene::newLineSegments (LineSegments::SubType subtype, RTCGeometryFlags gflags, size_t numSegments, size_t numVertices, size_t numTimeSteps)
+  {
+    if (isStatic() && (gflags != RTC_GEOMETRY_STATIC)) {
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes can only contain static geometries");
+      return -1;
+    }
+
+    if (numTimeSteps == 0 || numTimeSteps > RTC_MAX_TIME_STEPS) {
+      throw_RTCError(RTC_INVALID_OPERATION,"maximal number of timesteps exceeded");
+      return -1;
+    }
+
+    return add(new LineSegments(this,subtype,gflags,numSegments,numVertices,numTimeSteps));
+  }
+#endif
+
+#if defined(EMBREE_GEOMETRY_POINTS)
+  unsigned Scene::newPoints (Points::SubType subtype, RTCGeometryFlags gflags, size_t numPoints, size_t numTimeSteps)
   {
     if (isStatic() && (gflags != RTC_GEOMETRY_STATIC)) {
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes can only contain static geometries");
@@ -664,7 +739,7 @@ namespace embree
       return -1;
     }
 
-    return add(new LineSegments(this,gflags,numSegments,numVertices,numTimeSteps));
+    return add(new Points(this,subtype,gflags,numPoints,numTimeSteps));
   }
 #endif
 
@@ -681,6 +756,7 @@ namespace embree
 
   void Scene::deleteGeometry(size_t geomID)
   {
+    checkModifiable();
     Lock<SpinLock> lock(geometriesMutex);
     
     if (isStatic())
@@ -693,6 +769,13 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"invalid geometry");
     
     geometry->disable();
+
+    /* the current generation may still get traced during the next asynchronous commit */
+    if (usesAsyncCommits) {
+      deferredGeometryDeletes.push_back(geomID);
+      return;
+    }
+
     accels.deleteGeometry(unsigned(geomID));
     id_pool.deallocate((unsigned)geomID);
     geometries[geomID] = nullptr;
@@ -717,7 +800,7 @@ namespace embree
     }
   }
 
-  void Scene::commit_task ()
+  void Scene::build_task (AccelN& target)
   {
     progress_monitor_counter = 0;
 
@@ -727,13 +810,21 @@ namespace embree
       });
 
     /* select fast code path if no intersection filter is present */
-    accels.select(numIntersectionFiltersN+numIntersectionFilters4,
+    target.select(numIntersectionFiltersN+numIntersectionFilters4,
                   numIntersectionFiltersN+numIntersectionFilters8,
                   numIntersectionFiltersN+numIntersectionFilters16,
                   numIntersectionFiltersN);
   
     /* build all hierarchies of this scene */
-    accels.build();
+    target.build();
+  }
+
+  void Scene::commit_task ()
+  {
+    /* rays do not traverse the scene during synchronous commits */
+    deleteDeferredGeometries();
+
+    build_task(accels);
 
     /* make static geometry immutable */
     if (isStatic()) accels.immutable();
@@ -757,7 +848,7 @@ namespace embree
 
 #if defined(TASKING_INTERNAL)
 
-  void Scene::commit (size_t threadIndex, size_t threadCount, bool useThreadPool) 
+  void Scene::commit (size_t threadIndex, size_t threadCount, bool useThreadPool, TaskScheduler::Priority priority) 
   {
     Lock<MutexSys> buildLock(buildMutex,false);
 
@@ -768,7 +859,7 @@ namespace embree
       scheduler = this->scheduler;
       if (scheduler == null) {
         buildLock.lock();
-        this->scheduler = scheduler = new TaskScheduler;
+        this->scheduler = scheduler = new TaskScheduler(priority);
       }
     }
 
@@ -782,15 +873,20 @@ namespace embree
     if (threadCount != 0)
       scheduler->wait_for_threads(threadCount);
 
+    joinAsyncCommit();
+    beginCommit();
+
     /* fast path for unchanged scenes */
     if (!isModified()) {
       scheduler->spawn_root([&]() { this->scheduler = nullptr; }, 1, useThreadPool);
+      endCommit();
       return;
     }
 
     /* report error if scene not ready */
     if (!ready()) {
       scheduler->spawn_root([&]() { this->scheduler = nullptr; }, 1, useThreadPool);
+      endCommit();
       throw_RTCError(RTC_INVALID_OPERATION,"not all buffers are unmapped");
     }
 
@@ -799,17 +895,19 @@ namespace embree
       scheduler->spawn_root([&]() { commit_task(); this->scheduler = nullptr; }, 1, useThreadPool);
     }
     catch (...) {
-      accels.clear();
-      updateInterface();
+      this->scheduler = nullptr;
+      abortCommit();
+      endCommit();
       throw;
     }
+    endCommit();
   }
 
 #endif
 
 #if defined(TASKING_TBB) || defined(TASKING_PPL)
 
-  void Scene::commit (size_t threadIndex, size_t threadCount, bool useThreadPool) 
+  void Scene::commit (size_t threadIndex, size_t threadCount, bool useThreadPool, TaskScheduler::Priority priority) 
   {
     /* let threads wait for build to finish in rtcCommitThread mode */
     if (threadCount != 0) {
@@ -849,13 +947,18 @@ namespace embree
       return;
     }
 
+    joinAsyncCommit();
+    beginCommit();
+
     if (!isModified()) {
       if (threadCount) group_barrier.wait(threadCount);
+      endCommit();
       return;
     }
 
     if (!ready()) {
       if (threadCount) group_barrier.wait(threadCount);
+      endCommit();
       throw_RTCError(RTC_INVALID_OPERATION,"not all buffers are unmapped");
       return;
     }
@@ -871,7 +974,9 @@ namespace embree
 #else
       tbb::task_group_context ctx( tbb::task_group_context::isolated, tbb::task_group_context::default_traits | tbb::task_group_context::fp_settings );
 #endif
-      //ctx.set_priority(tbb::priority_high);
+#if defined(__TBB_TASK_PRIORITY) && __TBB_TASK_PRIORITY
+      ctx.set_priority(TaskScheduler::priority(priority));
+#endif
 
 #if USE_TASK_ARENA
       device->arena->execute([&]{
@@ -901,10 +1006,11 @@ namespace embree
       /* reset MXCSR register again */
       _mm_setcsr(mxcsr);
       
-      accels.clear();
-      updateInterface();
+      abortCommit();
+      endCommit();
       throw;
     }
+    endCommit();
   }
 #endif
 
@@ -917,8 +1023,205 @@ namespace embree
     mutex.unlock();
   }
 
+  void Scene::abortCommit()
+  {
+    /* a cancelled or interrupted build keeps all per object
+     * hierarchies that got finished, the scene cannot get traced
+     * until the next commit completes */
+    if (cancelRequested || timeSliceExpired) {
+      intersectors = Accel::Intersectors(missing_rtcCommit);
+      return;
+    }
+    accels.clear();
+    updateInterface();
+  }
+
+  void Scene::cancelCommit()
+  {
+    Lock<SpinLock> lock(cancelMutex);
+    if (commitRunning) cancelRequested = true;
+    else               cancelNext = true;
+  }
+
+  void Scene::beginCommit()
+  {
+    Lock<SpinLock> lock(cancelMutex);
+    commitRunning = true;
+    cancelRequested = cancelNext;
+    cancelNext = false;
+  }
+
+  void Scene::endCommit()
+  {
+    Lock<SpinLock> lock(cancelMutex);
+    commitRunning = false;
+    cancelRequested = false;
+  }
+
+  bool Scene::commitTimeSliced(double seconds)
+  {
+    timeSliceExpired = false;
+    timeSliceEnd = getSeconds() + seconds*timeSliceScale;
+    try {
+      commit(0,0,true);
+    }
+    catch (...) 
+    {
+      timeSliceEnd = inf;
+      if (!timeSliceExpired) throw;
+      timeSliceExpired = false;
+      timeSliceScale *= 2.0;
+      return false;
+    }
+    timeSliceEnd = inf;
+    timeSliceScale = 1.0;
+    return true;
+  }
+
+  void Scene::commitAsync()
+  {
+    if (isStatic())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get committed asynchronously");
+
+    if (world.numBezierCurves || worldMB.numBezierCurves || world.numSubdivPatches || worldMB.numSubdivPatches)
+      throw_RTCError(RTC_INVALID_OPERATION,"asynchronous commits do not support curves and subdivision meshes");
+
+    if (asyncThread)
+      throw_RTCError(RTC_INVALID_OPERATION,"asynchronous commit already running");
+
+    if (!ready())
+      throw_RTCError(RTC_INVALID_OPERATION,"not all buffers are unmapped");
+
+    /* an unchanged scene does not need a new generation */
+    if (!isModified()) {
+      beginCommit();
+      endCommit();
+      return;
+    }
+
+    /* create second generation of the same acceleration structures */
+    asyncAccels = new AccelN;
+    accels.swap(*asyncAccels);
+    createAccels();
+    accels.swap(*asyncAccels);
+    usesAsyncCommits = true;
+
+    /* rays keep traversing the current generation */
+    setModified(false);
+    asyncDone = false;
+    asyncException = nullptr;
+    beginCommit();
+    asyncThread = createThread((thread_func)asyncCommitThread,this);
+  }
+
+  void Scene::asyncCommitThread(Scene* scene)
+  {
+    /* for best performance set FTZ and DAZ flags in the MXCSR control and status register */
+    _mm_setcsr(_mm_getcsr() | /* FTZ */ (1<<15) | /* DAZ */ (1<<6));
+
+    try {
+#if defined(TASKING_INTERNAL)
+      Ref<TaskScheduler> scheduler = new TaskScheduler(TaskScheduler::PRIORITY_LOW);
+      scheduler->spawn_root([&]() { scene->build_task(*scene->asyncAccels); }, 1, true);
+#elif defined(TASKING_TBB)
+#if TBB_INTERFACE_VERSION_MAJOR < 8    
+      tbb::task_group_context ctx( tbb::task_group_context::isolated, tbb::task_group_context::default_traits);
+#else
+      tbb::task_group_context ctx( tbb::task_group_context::isolated, tbb::task_group_context::default_traits | tbb::task_group_context::fp_settings );
+#endif
+#if defined(__TBB_TASK_PRIORITY) && __TBB_TASK_PRIORITY
+      ctx.set_priority(TaskScheduler::priority(TaskScheduler::PRIORITY_LOW));
+#endif
+#if USE_TASK_ARENA
+      scene->device->arena->execute([&]{
+#endif
+          tbb::parallel_for (size_t(0), size_t(1), size_t(1), [&] (size_t) { scene->build_task(*scene->asyncAccels); }, ctx);
+#if USE_TASK_ARENA
+        });
+#endif
+#else
+      scene->build_task(*scene->asyncAccels);
+#endif
+    } 
+    catch (...) {
+      scene->asyncException = std::current_exception();
+    }
+    scene->asyncDone = true;
+  }
+
+  bool Scene::finishAsyncCommit(bool wait)
+  {
+    if (asyncThread == nullptr) 
+      return true;
+
+    if (!wait && !asyncDone)
+      return false;
+
+    embree::join(asyncThread);
+    asyncThread = nullptr;
+    endCommit();
+
+    /* keep the current generation if the build failed */
+    if (asyncException != nullptr) {
+      std::exception_ptr except = asyncException;
+      asyncException = nullptr;
+      delete asyncAccels; asyncAccels = nullptr;
+      setModified();
+      std::rethrow_exception(except);
+    }
+
+    /* swap generations, no rays traverse the scene during this call,
+     * thus the previous generation can get released immediately */
+    accels.swap(*asyncAccels);
+    delete asyncAccels; asyncAccels = nullptr;
+    parallel_for(geometries.size(), [&] ( const size_t i ) {
+        if (geometries[i]) geometries[i]->postCommit();
+      });
+    updateInterface();
+
+    /* the old generation is not traversed anymore */
+    deleteDeferredGeometries();
+    return true;
+  }
+
+  void Scene::deleteDeferredGeometries()
+  {
+    for (size_t geomID : deferredGeometryDeletes)
+    {
+      accels.deleteGeometry(unsigned(geomID));
+      id_pool.deallocate((unsigned)geomID);
+      delete geometries[geomID];
+      geometries[geomID] = nullptr;
+    }
+    deferredGeometryDeletes.clear();
+  }
+
+  void Scene::joinAsyncCommit()
+  {
+    /* a failed asynchronous commit marked the scene as modified, its
+     * changes get built by the synchronous commit instead */
+    try {
+      finishAsyncCommit(true);
+    } catch (...) {
+    }
+  }
+
+  void Scene::checkModifiable() const
+  {
+    if (asyncThread)
+      throw_RTCError(RTC_INVALID_OPERATION,"scene cannot get modified during an asynchronous commit");
+  }
+
   void Scene::progressMonitor(double dn)
   {
+    if (unlikely(cancelRequested))
+      throw_RTCError(RTC_CANCELLED,"commit got cancelled");
+
+    if (unlikely(timeSliceEnd != double(inf)) && getSeconds() > timeSliceEnd) {
+      timeSliceExpired = true;
+      throw_RTCError(RTC_CANCELLED,"time slice expired");
+    }
+
     if (progress_monitor_function) {
       size_t n = size_t(dn) + progress_monitor_counter.fetch_add(size_t(dn));
       if (!progress_monitor_function(progress_monitor_ptr, n / (double(numPrimitives())))) {
@@ -25,6 +25,7 @@
 #include "scene_geometry_instance.h"
 #include "scene_bezier_curves.h"
 #include "scene_line_segments.h"
+#include "scene_points.h"
 #include "scene_subdiv_mesh.h"
 
 #include "../subdiv/tessellation_cache.h"
@@ -117,6 +118,8 @@ namespace embree
     void createHairMBAccel();
     void createLineAccel();
     void createLineMBAccel();
+    void createPointAccel();
+    void createPointMBAccel();
     void createSubdivAccel();
     void createSubdivMBAccel();
     void createUserGeometryAccel();
@@ -147,7 +150,10 @@ namespace embree
     unsigned int newCurves (NativeCurves::SubType subtype, NativeCurves::Basis basis, RTCGeometryFlags flags, size_t maxCurves, size_t maxVertices, size_t numTimeSteps);
 
     /*! Creates a new collection of line segments. */
-    unsigned int newLineSegments (RTCGeometryFlags flags, size_t maxSegments, size_t maxVertices, size_t numTimeSteps);
+    unsigned int newLineSegments (LineSegments::SubType subtype, RTCGeometryFlags flags, size_t maxSegments, size_t maxVertices, size_t numTimeSteps);
+
+    /*! Creates a new collection of spheres or discs. */
+    unsigned int newPoints (Points::SubType subtype, RTCGeometryFlags flags, size_t maxPoints, size_t numTimeSteps);
 
     /*! Creates a new subdivision mesh. */
     unsigned int newSubdivisionMesh (RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles, size_t numTimeSteps);
@@ -156,8 +162,23 @@ namespace embree
     void deleteGeometry(size_t geomID);
 
     /*! Builds acceleration structure for the scene. */
-    void commit (size_t threadIndex, size_t threadCount, bool useThreadPool);
+    void commit (size_t threadIndex, size_t threadCount, bool useThreadPool, TaskScheduler::Priority priority = TaskScheduler::PRIORITY_NORMAL);
     void commit_task ();
+
+    /*! Builds acceleration structure for at most some seconds, returns true if the build finished. */
+    bool commitTimeSliced (double seconds);
+
+    /*! Cancels the running or next commit. */
+    void cancelCommit ();
+
+    /*! Builds a new generation of acceleration structures in the background. */
+    void commitAsync ();
+
+    /*! Makes the generation built by commitAsync current, returns false if the build did not finish yet and wait is false. */
+    bool finishAsyncCommit (bool wait);
+
+    /*! Reports an error if the scene gets modified while an asynchronous commit builds from it. */
+    void checkModifiable () const;
     void build () {}
 
     void updateInterface();
@@ -205,6 +226,7 @@ namespace embree
     }
 
     __forceinline Geometry* get_locked(size_t i)  {
+      checkModifiable();
       Lock<SpinLock> lock(geometriesMutex);
       Geometry *g = geometries[i]; 
       assert(i < geometries.size()); 
@@ -254,6 +276,7 @@ namespace embree
     bool needBezierVertices;
     bool needLineIndices;
     bool needLineVertices;
+    bool needPointVertices;
     bool needSubdivIndices;
     bool needSubdivVertices;
     MutexSys buildMutex;
@@ -286,22 +309,64 @@ namespace embree
     void* progress_monitor_ptr;
     std::atomic<size_t> progress_monitor_counter;
     void progressMonitor(double nprims);
+
+    /*! cleans up after a failed, cancelled, or interrupted build */
+    void abortCommit();
+
+    /*! marks begin and end of each commit, cancel requests never outlive the commit they belong to */
+    void beginCommit();
+    void endCommit();
+
+  private:
+    /*! creates all acceleration structures of the scene */
+    void createAccels();
+
+    /*! builds some generation of acceleration structures */
+    void build_task (AccelN& target);
+
+    /*! finally deletes geometries that got deleted while an old generation could get traced */
+    void deleteDeferredGeometries();
+
+    /*! waits for a running asynchronous commit before a synchronous commit */
+    void joinAsyncCommit();
+
+    /*! thread function of asynchronous commits */
+    static void asyncCommitThread(Scene* scene);
+
+    AccelN* asyncAccels;                    //!< second generation of acceleration structures, only alive during asynchronous commits
+    bool usesAsyncCommits;                  //!< true once the scene got committed asynchronously
+    thread_t asyncThread;                   //!< thread of the running asynchronous commit
+    std::atomic<bool> asyncDone;            //!< true if the asynchronous build finished
+    std::exception_ptr asyncException;      //!< exception thrown by the asynchronous build
+    std::vector<size_t> deferredGeometryDeletes; //!< geometries deleted while an old generation can get traced
+
+  private:
+    SpinLock cancelMutex;              //!< orders cancel requests with begin and end of commits
+    bool commitRunning;                //!< true between beginCommit and endCommit
+    bool cancelNext;                   //!< set by rtcCancelCommit if no commit is running, cancels the next commit
+    std::atomic<bool> cancelRequested; //!< set by rtcCancelCommit, checked at each progress checkpoint
+    std::atomic<bool> timeSliceExpired;//!< true if the last build got interrupted by the end of its time slice
+    double timeSliceEnd;               //!< end time of the time slice of the current build, inf if not time sliced
+    double timeSliceScale;             //!< doubles with each expired time slice to guarantee progress
+
+  public:
     void setProgressMonitorFunction(RTCProgressMonitorFunc func, void* ptr);
 
   public:
     struct GeometryCounts 
     {
       __forceinline GeometryCounts()
-        : numTriangles(0), numQuads(0), numBezierCurves(0), numLineSegments(0), numSubdivPatches(0), numUserGeometries(0) {}
+        : numTriangles(0), numQuads(0), numBezierCurves(0), numLineSegments(0), numPoints(0), numSubdivPatches(0), numUserGeometries(0) {}
 
       __forceinline size_t size() const {
-        return numTriangles + numQuads + numBezierCurves + numLineSegments + numSubdivPatches + numUserGeometries;
+        return numTriangles + numQuads + numBezierCurves + numLineSegments + numPoints + numSubdivPatches + numUserGeometries;
       }
 
       std::atomic<size_t> numTriangles;             //!< number of enabled triangles
       std::atomic<size_t> numQuads;                 //!< number of enabled quads
       std::atomic<size_t> numBezierCurves;          //!< number of enabled curves
       std::atomic<size_t> numLineSegments;          //!< number of enabled line segments
+      std::atomic<size_t> numPoints;                //!< number of enabled points
       std::atomic<size_t> numSubdivPatches;         //!< number of enabled subdivision patches
       std::atomic<size_t> numUserGeometries;        //!< number of enabled user geometries
     };
@@ -344,6 +409,8 @@ namespace embree
   template<> __forceinline size_t Scene::getNumPrimitives<NativeCurves,true>() const { return worldMB.numBezierCurves; }
   template<> __forceinline size_t Scene::getNumPrimitives<LineSegments,false>() const { return world.numLineSegments; }
   template<> __forceinline size_t Scene::getNumPrimitives<LineSegments,true>() const { return worldMB.numLineSegments; }
+  template<> __forceinline size_t Scene::getNumPrimitives<Points,false>() const { return world.numPoints; }
+  template<> __forceinline size_t Scene::getNumPrimitives<Points,true>() const { return worldMB.numPoints; }
   template<> __forceinline size_t Scene::getNumPrimitives<SubdivMesh,false>() const { return world.numSubdivPatches; }
   template<> __forceinline size_t Scene::getNumPrimitives<SubdivMesh,true>() const { return worldMB.numSubdivPatches; }
   template<> __forceinline size_t Scene::getNumPrimitives<AccelSet,false>() const { return world.numUserGeometries; }
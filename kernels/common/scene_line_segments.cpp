@@ -19,8 +19,8 @@
 
 namespace embree
 {
-  LineSegments::LineSegments (Scene* parent, RTCGeometryFlags flags, size_t numPrimitives, size_t numVertices, size_t numTimeSteps)
-    : Geometry(parent,LINE_SEGMENTS,numPrimitives,numTimeSteps,flags)
+  LineSegments::LineSegments (Scene* parent, SubType subtype, RTCGeometryFlags flags, size_t numPrimitives, size_t numVertices, size_t numTimeSteps)
+    : Geometry(parent,LINE_SEGMENTS,numPrimitives,numTimeSteps,flags), subtype(subtype)
   {
     segments.init(parent->device,numPrimitives,sizeof(int));
     vertices.resize(numTimeSteps);
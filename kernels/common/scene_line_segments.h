@@ -28,10 +28,16 @@ namespace embree
     /*! type of this geometry */
     static const Geometry::Type geom_type = Geometry::LINE_SEGMENTS;
 
+    /*! line segment types */
+    enum SubType {
+      FLAT  = 0,  //!< ray facing ribbons
+      ROUND = 1   //!< cones connected by sphere joints
+    };
+
   public:
 
     /*! line segments construction */
-    LineSegments (Scene* parent, RTCGeometryFlags flags, size_t numPrimitives, size_t numVertices, size_t numTimeSteps);
+    LineSegments (Scene* parent, SubType subtype, RTCGeometryFlags flags, size_t numPrimitives, size_t numVertices, size_t numTimeSteps);
 
   public:
     void enabling();
@@ -172,6 +178,7 @@ namespace embree
     }
 
   public:
+    SubType subtype;                                  //!< flat or round line segments
     APIBuffer<unsigned int> segments;                 //!< array of line segment indices
     BufferRefT<Vec3fa> vertices0;                     //!< fast access to first vertex buffer
     vector<APIBuffer<Vec3fa>> vertices;               //!< vertex array for each timestep
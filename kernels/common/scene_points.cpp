@@ -0,0 +1,212 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#include "scene_points.h"
+#include "scene.h"
+
+namespace embree
+{
+  Points::Points (Scene* parent, SubType subtype, RTCGeometryFlags flags, size_t numPrimitives, size_t numTimeSteps)
+    : Geometry(parent,POINTS,numPrimitives,numTimeSteps,flags), subtype(subtype)
+  {
+    vertices.resize(numTimeSteps);
+    for (size_t i=0; i<numTimeSteps; i++) {
+      vertices[i].init(parent->device,numPrimitives,sizeof(Vec3fa));
+    }
+    if (subtype == ORIENTED_DISC) 
+    {
+      normals.resize(numTimeSteps);
+      for (size_t i=0; i<numTimeSteps; i++) {
+        normals[i].init(parent->device,numPrimitives,sizeof(Vec3fa));
+      }
+    }
+    enabling();
+  }
+
+  void Points::enabling()
+  {
+    if (numTimeSteps == 1) parent->world.numPoints += numPrimitives;
+    else                   parent->worldMB.numPoints += numPrimitives;
+  }
+
+  void Points::disabling()
+  {
+    if (numTimeSteps == 1) parent->world.numPoints -= numPrimitives;
+    else                   parent->worldMB.numPoints -= numPrimitives;
+  }
+
+  void Points::setMask (unsigned mask)
+  {
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static geometries cannot get modified");
+
+    this->mask = mask;
+    Geometry::update();
+  }
+
+  void Points::setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride, size_t size)
+  {
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static geometries cannot get modified");
+
+    /* verify that all accesses are 4 bytes aligned */
+    if (((size_t(ptr) + offset) & 0x3) || (stride & 0x3))
+      throw_RTCError(RTC_INVALID_OPERATION,"data must be 4 bytes aligned");
+
+    unsigned bid = type & 0xFFFF;
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) 
+    {
+      /* the first vertex buffer defines the number of points */
+      size_t t = type - RTC_VERTEX_BUFFER0;
+      if (t == 0 && size != (size_t)-1) disabling();
+      vertices[t].set(ptr,offset,stride,size);
+      vertices[t].checkPadding16();
+      vertices0 = vertices[0];
+      if (t == 0 && size != (size_t)-1) {
+        setNumPrimitives(size);
+        enabling();
+      }
+    } 
+    else if (subtype == ORIENTED_DISC && type >= RTC_NORMAL_BUFFER0 && type < RTCBufferType(RTC_NORMAL_BUFFER0 + numTimeSteps)) 
+    {
+      size_t t = type - RTC_NORMAL_BUFFER0;
+      normals[t].set(ptr,offset,stride,size);
+      normals[t].checkPadding16();
+    }
+    else if (type >= RTC_USER_VERTEX_BUFFER0 && type < RTC_USER_VERTEX_BUFFER0+RTC_MAX_USER_VERTEX_BUFFERS)
+    {
+      if (bid >= userbuffers.size()) userbuffers.resize(bid+1);
+      userbuffers[bid] = APIBuffer<char>(parent->device,numVertices(),stride);
+      userbuffers[bid].set(ptr,offset,stride,size);
+      userbuffers[bid].checkPadding16();
+    }
+    else
+      throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type");
+  }
+
+  void* Points::map(RTCBufferType type)
+  {
+    if (parent->isStatic() && parent->isBuild()) {
+      throw_RTCError(RTC_INVALID_OPERATION,"static geometries cannot get modified");
+      return nullptr;
+    }
+
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) {
+      return vertices[type - RTC_VERTEX_BUFFER0].map(parent->numMappedBuffers);
+    }
+    else if (subtype == ORIENTED_DISC && type >= RTC_NORMAL_BUFFER0 && type < RTCBufferType(RTC_NORMAL_BUFFER0 + numTimeSteps)) {
+      return normals[type - RTC_NORMAL_BUFFER0].map(parent->numMappedBuffers);
+    }
+    else {
+      throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type"); 
+      return nullptr;
+    }
+  }
+
+  void Points::unmap(RTCBufferType type)
+  {
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static geometries cannot get modified");
+
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) {
+      vertices[type - RTC_VERTEX_BUFFER0].unmap(parent->numMappedBuffers);
+      vertices0 = vertices[0];
+    }
+    else if (subtype == ORIENTED_DISC && type >= RTC_NORMAL_BUFFER0 && type < RTCBufferType(RTC_NORMAL_BUFFER0 + numTimeSteps)) {
+      normals[type - RTC_NORMAL_BUFFER0].unmap(parent->numMappedBuffers);
+    }
+    else {
+      throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type"); 
+    }
+  }
+
+  void Points::immutable ()
+  {
+    const bool freeVertices = !parent->needPointVertices;
+    if (freeVertices) {
+      for (auto& buffer : vertices) buffer.free();
+      for (auto& buffer : normals ) buffer.free();
+    }
+  }
+
+  bool Points::verify ()
+  { 
+    /*! verify consistent size of vertex and normal arrays */
+    if (vertices.size() == 0) return false;
+    for (const auto& buffer : vertices)
+      if (buffer.size() != numVertices())
+        return false;
+    for (const auto& buffer : normals)
+      if (buffer.size() != numVertices())
+        return false;
+
+    /*! verify vertices */
+    for (const auto& buffer : vertices) {
+      for (size_t i=0; i<buffer.size(); i++) {
+	if (!isvalid(buffer[i].x)) return false;
+        if (!isvalid(buffer[i].y)) return false;
+        if (!isvalid(buffer[i].z)) return false;
+        if (!isvalid(buffer[i].w)) return false;
+      }
+    }
+
+    /*! verify normals */
+    for (const auto& buffer : normals) {
+      for (size_t i=0; i<buffer.size(); i++) {
+	if (!isvalid(buffer[i].x)) return false;
+        if (!isvalid(buffer[i].y)) return false;
+        if (!isvalid(buffer[i].z)) return false;
+      }
+    }
+    return true;
+  }
+
+  void Points::interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats)
+  {
+    /* test if interpolation is enabled */
+#if defined(DEBUG)
+    if ((parent->aflags & RTC_INTERPOLATE) == 0)
+      throw_RTCError(RTC_INVALID_OPERATION,"rtcInterpolate can only get called when RTC_INTERPOLATE is enabled for the scene");
+#endif
+
+    /* calculate base pointer and stride */
+    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) ||
+           (buffer >= RTC_USER_VERTEX_BUFFER0 && buffer <= RTC_USER_VERTEX_BUFFER1));
+    const char* src = nullptr;
+    size_t stride = 0;
+    if (buffer >= RTC_USER_VERTEX_BUFFER0) {
+      src    = userbuffers[buffer&0xFFFF].getPtr();
+      stride = userbuffers[buffer&0xFFFF].getStride();
+    } else {
+      src    = vertices[buffer&0xFFFF].getPtr();
+      stride = vertices[buffer&0xFFFF].getStride();
+    }
+
+    /* attributes are constant over a point */
+    for (size_t i=0; i<numFloats; i+=VSIZEX)
+    {
+      const size_t ofs = i*sizeof(float);
+      const vboolx valid = vintx((int)i)+vintx(step) < vintx(numFloats);
+      const vfloatx p0 = vfloatx::loadu(valid,(float*)&src[primID*stride+ofs]);
+      if (P      ) vfloatx::storeu(valid,P+i,p0);
+      if (dPdu   ) vfloatx::storeu(valid,dPdu+i,vfloatx(zero));
+      if (dPdv   ) vfloatx::storeu(valid,dPdv+i,vfloatx(zero));
+      if (ddPdudu) vfloatx::storeu(valid,ddPdudu+i,vfloatx(zero));
+      if (ddPdvdv) vfloatx::storeu(valid,ddPdvdv+i,vfloatx(zero));
+      if (ddPdudv) vfloatx::storeu(valid,ddPdudv+i,vfloatx(zero));
+    }
+  }
+}
@@ -0,0 +1,171 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "default.h"
+#include "geometry.h"
+#include "buffer.h"
+
+namespace embree
+{
+  /*! represents an array of spheres or discs */
+  struct Points : public Geometry
+  {
+    /*! type of this geometry */
+    static const Geometry::Type geom_type = Geometry::POINTS;
+
+    /*! shape of the points */
+    enum SubType { SPHERE = 0, DISC = 1, ORIENTED_DISC = 2 };
+
+  public:
+
+    /*! points construction */
+    Points (Scene* parent, SubType subtype, RTCGeometryFlags flags, size_t numPrimitives, size_t numTimeSteps);
+
+  public:
+    void enabling();
+    void disabling();
+    void setMask (unsigned mask);
+    void setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride, size_t size);
+    void* map(RTCBufferType type);
+    void unmap(RTCBufferType type);
+    void immutable ();
+    bool verify ();
+    void interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
+
+  public:
+
+    /*! returns number of points */
+    __forceinline size_t size() const {
+      return numPrimitives;
+    }
+
+    /*! returns the number of vertices */
+    __forceinline size_t numVertices() const {
+      return vertices[0].size();
+    }
+
+    /*! returns i'th vertex of the first time step */
+    __forceinline Vec3fa vertex(size_t i) const {
+      return vertices0[i];
+    }
+
+    /*! returns i'th vertex of the first time step */
+    __forceinline const char* vertexPtr(size_t i) const {
+      return vertices0.getPtr(i);
+    }
+
+    /*! returns i'th vertex of itime'th timestep */
+    __forceinline Vec3fa vertex(size_t i, size_t itime) const {
+      return vertices[itime][i];
+    }
+
+    /*! returns i'th vertex of itime'th timestep */
+    __forceinline const char* vertexPtr(size_t i, size_t itime) const {
+      return vertices[itime].getPtr(i);
+    }
+
+    /*! returns i'th normal of itime'th timestep */
+    __forceinline Vec3fa normal(size_t i, size_t itime) const {
+      return normals[itime][i];
+    }
+
+    /*! returns i'th normal of itime'th timestep */
+    __forceinline const char* normalPtr(size_t i, size_t itime) const {
+      return normals[itime].getPtr(i);
+    }
+
+    /*! calculates bounding box of i'th point for the itime'th time step */
+    __forceinline BBox3fa bounds(size_t i, size_t itime = 0) const
+    {
+      const Vec3fa v = vertex(i,itime);
+      const BBox3fa b(v);
+      if (subtype != ORIENTED_DISC)
+        return enlarge(b,Vec3fa(v.w));
+
+      /* a disc only extends by r*sqrt(1-n_i^2) along each axis */
+      const Vec3fa n = normalize(normal(i,itime));
+      const Vec3fa e = v.w*sqrt(max(Vec3fa(one)-n*n,Vec3fa(zero)));
+      return enlarge(b,e);
+    }
+
+    /*! check if the i'th primitive is valid at the itime'th timestep */
+    __forceinline bool valid(size_t i, size_t itime) const {
+      return valid(i, make_range(itime, itime));
+    }
+
+    /*! check if the i'th primitive is valid between the specified time range */
+    __forceinline bool valid(size_t i, const range<size_t>& itime_range) const
+    {
+      if (i >= numVertices()) return false;
+      
+      for (size_t itime = itime_range.begin(); itime <= itime_range.end(); itime++)
+      {
+        const Vec3fa v = vertex(i,itime); if (unlikely(!isvalid((vfloat4)v))) return false;
+        if (v.w < 0.0f) return false;
+        if (subtype == ORIENTED_DISC) {
+          const Vec3fa n = normal(i,itime); 
+          if (unlikely(!isvalid(n.x) || !isvalid(n.y) || !isvalid(n.z))) return false;
+          if (dot(n,n) == 0.0f) return false;
+        }
+      }
+      return true;
+    }
+
+    /*! calculates the linear bounds of the i'th primitive at the itimeGlobal'th time segment */
+    __forceinline LBBox3fa linearBounds(size_t i, size_t itimeGlobal, size_t numTimeStepsGlobal) const
+    {
+      return Geometry::linearBounds([&] (size_t itime) { return bounds(i, itime); },
+                                    itimeGlobal, numTimeStepsGlobal, numTimeSteps);
+    }
+
+    /*! calculates the build bounds of the i'th primitive, if it's valid */
+    __forceinline bool buildBounds(size_t i, BBox3fa* bbox) const
+    {
+      if (!valid(i,0)) return false;
+      *bbox = bounds(i); 
+      return true;
+    }
+
+    /*! calculates the build bounds of the i'th primitive at the itime'th time segment, if it's valid */
+    __forceinline bool buildBounds(size_t i, size_t itime, BBox3fa& bbox) const
+    {
+      if (!valid(i,itime+0) || !valid(i,itime+1)) return false;
+      bbox = bounds(i,itime);  // use bounds of first time step in builder
+      return true;
+    }
+
+    /*! calculates the build bounds of the i'th primitive at the itimeGlobal'th time segment, if it's valid */
+    __forceinline bool buildBounds(size_t i, size_t itimeGlobal, size_t numTimeStepsGlobal, BBox3fa& bbox) const
+    {
+      return Geometry::buildBounds([&] (size_t itime, BBox3fa& bbox) -> bool
+                                   {
+                                     if (unlikely(!valid(i, itime))) return false;
+                                     bbox = bounds(i, itime);
+                                     return true;
+                                   },
+                                   itimeGlobal, numTimeStepsGlobal, numTimeSteps, bbox);
+    }
+
+  public:
+    SubType subtype;                                  //!< sphere, ray facing disc, or oriented disc
+    BufferRefT<Vec3fa> vertices0;                     //!< fast access to first vertex buffer
+    vector<APIBuffer<Vec3fa>> vertices;               //!< vertex array for each timestep
+    vector<APIBuffer<Vec3fa>> normals;                //!< normal array for each timestep, only used for oriented discs
+    vector<APIBuffer<char>> userbuffers;              //!< user buffers
+  };
+}
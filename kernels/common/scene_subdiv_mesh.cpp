@@ -32,9 +32,11 @@ namespace embree
       displFunc2(nullptr),
       displBounds(empty),
       tessellationRate(2.0f),
+      adaptiveTessellation(false),
       numHalfEdges(0),
       faceStartEdge(parent->device),
-      invalid_face(parent->device)
+      invalid_face(parent->device),
+      adaptiveLevels(parent->device)
   {
     vertices.resize(numTimeSteps);
     vertex_buffer_tags.resize(numTimeSteps);
@@ -334,6 +336,90 @@ namespace embree
     levels.setModified(true);
   }
 
+  void SubdivMesh::setTessellationCamera(const RTCTessellationCamera* camera)
+  {
+    if (parent->isStatic() && parent->isBuild()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"static geometries cannot get modified");
+
+    if (camera) {
+      if (!(camera->pixelScale > 0.0f) || !(camera->edgeLength > 0.0f) || !(camera->maxLevel >= 1.0f))
+        throw_RTCError(RTC_INVALID_ARGUMENT,"invalid tessellation camera");
+      tessellationCamera = *camera;
+    }
+    adaptiveTessellation = camera != nullptr;
+    levels.setModified(true);
+  }
+
+  void SubdivMesh::calculateAdaptiveLevels()
+  {
+    adaptiveLevels.resize(numEdges());
+
+    const Vec3vfx camera(vfloatx(tessellationCamera.position[0]),vfloatx(tessellationCamera.position[1]),vfloatx(tessellationCamera.position[2]));
+    const vfloatx scale(tessellationCamera.pixelScale/tessellationCamera.edgeLength);
+    const vfloatx maxLevel(min(tessellationCamera.maxLevel,4096.0f));
+    const APIBuffer<unsigned>& vertexIndices = topology[0].vertexIndices;
+    const size_t numVerts = numVertices();
+
+    parallel_for( size_t(0), numFaces(), size_t(4096), [&](const range<size_t>& r) 
+    {
+      /* edges are gathered into batches of VSIZEX edges that get evaluated together */
+      unsigned edgeID[VSIZEX], v0ID[VSIZEX], v1ID[VSIZEX];
+      size_t numBatch = 0;
+
+      auto evaluateBatch = [&] ()
+      {
+        /* the level is the maximal level over all time steps, it
+         * only depends on the unordered pair of edge vertices, thus
+         * both half edges of an edge get the same level */
+        vfloatx level(1.0f);
+        for (size_t t=0; t<numTimeSteps; t++)
+        {
+          const BufferRefT<Vec3fa>& vtx = vertices[t];
+          Vec3vfx p0(zero), p1(zero);
+          for (size_t i=0; i<numBatch; i++) {
+            const Vec3fa a = vtx[v0ID[i]], b = vtx[v1ID[i]];
+            p0.x[i] = a.x; p0.y[i] = a.y; p0.z[i] = a.z;
+            p1.x[i] = b.x; p1.y[i] = b.y; p1.z[i] = b.z;
+          }
+          const vfloatx len  = length(p1-p0);
+          const vfloatx dist = max(distance(vfloatx(0.5f)*(p0+p1),camera),vfloatx(float(ulp)));
+          /* max returns the second argument for NaN levels of non finite vertices */
+          level = max(scale*len/dist,level);
+        }
+        level = min(level,maxLevel);
+        for (size_t i=0; i<numBatch; i++)
+          adaptiveLevels[edgeID[i]] = level[i];
+        numBatch = 0;
+      };
+
+      for (size_t f=r.begin(); f<r.end(); f++) 
+      {
+        const unsigned N = faceVertices[f];
+        const unsigned e = faceStartEdge[f];
+
+        /* faces with invalid vertex indices get discarded later, only give them a valid level */
+        bool validFace = true;
+        for (unsigned de=0; de<N; de++)
+          validFace &= vertexIndices[e+de] < numVerts;
+
+        for (unsigned de=0; de<N; de++)
+        {
+          if (unlikely(!validFace)) {
+            adaptiveLevels[e+de] = 1.0f;
+            continue;
+          }
+          const unsigned i0 = vertexIndices[e+de];
+          const unsigned i1 = vertexIndices[e+(de+1)%N];
+          edgeID[numBatch] = e+de;
+          v0ID[numBatch] = min(i0,i1);
+          v1ID[numBatch] = max(i0,i1);
+          if (++numBatch == VSIZEX) evaluateBatch();
+        }
+      }
+      if (numBatch) evaluateBatch();
+    });
+  }
+
   void SubdivMesh::immutable () 
   {
     const bool freeVertices = !parent->needSubdivVertices;
@@ -693,6 +779,19 @@ namespace embree
     if (holes.isModified())
       holeSet.init(holes);
 
+    /* calculate view dependent edge levels */
+    if (adaptiveTessellation) 
+    {
+      bool verticesModified = false;
+      for (auto& buffer : vertices) verticesModified |= buffer.isModified();
+      if (levels.isModified() || faceVertices.isModified() || topology[0].vertexIndices.isModified() || verticesModified) {
+        calculateAdaptiveLevels();
+        levels.setModified(true);
+      }
+    }
+    else
+      adaptiveLevels.clear();
+
     /* create topology */
     for (auto& t: topology)
       t.initializeHalfEdgeStructures();
@@ -720,6 +819,7 @@ namespace embree
     {
       vertexCreaseMap.clear();
       edgeCreaseMap.clear();
+      adaptiveLevels.clear();
     }
 
     /* clear modified state of all buffers */
@@ -844,6 +944,14 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"rtcInterpolate can only get called when RTC_INTERPOLATE is enabled for the scene");
 #endif
 
+    const int* valid = (const int*) valid_i;
+
+    /* large batches are evaluated patch by patch */
+    if (numUVs >= INTERPOLATE_SORT_THRESHOLD && numUVs <= 0xFFFFFFFF) {
+      interpolateSortedN(valid,primIDs,u,v,numUVs,buffer,P,dPdu,dPdv,ddPdudu,ddPdvdv,ddPdudv,numFloats);
+      return;
+    }
+
     /* calculate base pointer and stride */
     assert((buffer >= RTC_VERTEX_BUFFER0 && buffer < RTCBufferType(RTC_VERTEX_BUFFER0 + RTC_MAX_TIME_STEPS)) ||
            (buffer >= RTC_USER_VERTEX_BUFFER0 && RTCBufferType(RTC_USER_VERTEX_BUFFER0 + RTC_MAX_USER_VERTEX_BUFFERS)));
@@ -867,8 +975,6 @@ namespace embree
       topo = &topology[0];
     }
 
-    const int* valid = (const int*) valid_i;
-    
     for (size_t i=0; i<numUVs; i+=4) 
     {
       vbool4 valid1 = vint4(i)+vint4(step) < vint4(numUVs);
@@ -897,4 +1003,53 @@ namespace embree
       });
     }
   }
+
+  void SubdivMesh::interpolateSortedN(const int* valid, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                                      RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats)
+  {
+    /* sort valid queries by primID, the lower 32 bits of each key store the query index */
+    std::vector<uint64_t> keys(numUVs), tmp(numUVs);
+    size_t numValid = 0;
+    for (size_t i=0; i<numUVs; i++)
+      if (!valid || valid[i] == -1)
+        keys[numValid++] = (uint64_t(primIDs[i]) << 32) | uint64_t(i);
+    radix_sort_u64(keys.data(),tmp.data(),numValid);
+
+    /* evaluate blocks of sorted queries into compact SoA buffers and scatter the results */
+    float* const dst[6] = { P, dPdu, dPdv, ddPdudu, ddPdvdv, ddPdudv };
+    const size_t B = INTERPOLATE_SORT_BLOCK_SIZE;
+    parallel_for(size_t(0), numValid, B, [&](const range<size_t>& r) 
+    {
+      unsigned blockPrimIDs[INTERPOLATE_SORT_BLOCK_SIZE];
+      float blockU[INTERPOLATE_SORT_BLOCK_SIZE];
+      float blockV[INTERPOLATE_SORT_BLOCK_SIZE];
+      dynamic_large_stack_array(float,blockDst,6*B*numFloats,32*1024);
+      
+      for (size_t i=r.begin(); i<r.end(); i+=B)
+      {
+        const size_t N = min(B,r.end()-i);
+        for (size_t k=0; k<N; k++) {
+          const unsigned index = unsigned(keys[i+k]);
+          blockPrimIDs[k] = unsigned(keys[i+k] >> 32);
+          blockU[k] = u[index];
+          blockV[k] = v[index];
+        }
+
+        float* blockPtr[6];
+        for (size_t o=0; o<6; o++)
+          blockPtr[o] = dst[o] ? &blockDst[o*N*numFloats] : nullptr;
+
+        interpolateN(nullptr,blockPrimIDs,blockU,blockV,N,buffer,
+                     blockPtr[0],blockPtr[1],blockPtr[2],blockPtr[3],blockPtr[4],blockPtr[5],numFloats);
+
+        for (size_t o=0; o<6; o++) 
+        {
+          if (!dst[o]) continue;
+          for (size_t j=0; j<numFloats; j++)
+            for (size_t k=0; k<N; k++)
+              dst[o][j*numUVs+unsigned(keys[i+k])] = blockPtr[o][j*N+k];
+        }
+      }
+    });
+  }
 }
@@ -76,6 +76,7 @@ namespace embree
     void update ();
     void updateBuffer (RTCBufferType type);
     void setTessellationRate(float N);
+    void setTessellationCamera(const RTCTessellationCamera* camera);
     void immutable ();
     bool verify ();
     void setDisplacementFunction (RTCDisplacementFunc func, RTCBounds* bounds);
@@ -84,6 +85,14 @@ namespace embree
     void interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
                       RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
 
+  protected:
+
+    /*! large batches are sorted by primID and evaluated in blocks of queries on the same patch */
+    static const size_t INTERPOLATE_SORT_THRESHOLD = 1024;
+    static const size_t INTERPOLATE_SORT_BLOCK_SIZE = 256;
+    void interpolateSortedN(const int* valid, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                            RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
+
   public:
 
     /*! return the number of faces */
@@ -137,6 +146,7 @@ namespace embree
     /* returns tessellation level of edge */
     __forceinline float getEdgeLevel(const size_t i) const
     {
+      if (adaptiveLevels.size()) return adaptiveLevels[i];
       if (levels) return clamp(levels[i],1.0f,4096.0f); // FIXME: do we want to limit edge level?
       else return clamp(tessellationRate,1.0f,4096.0f); // FIXME: do we want to limit edge level?
     }
@@ -279,6 +289,10 @@ namespace embree
     APIBuffer<float> levels;
     float tessellationRate;  // constant rate that is used when levels is not set
 
+    /*! camera for view dependent tessellation levels */
+    RTCTessellationCamera tessellationCamera;
+    bool adaptiveTessellation;
+
     /*! buffer that marks specific faces as holes */
     APIBuffer<unsigned> holes;
 
@@ -297,6 +311,12 @@ namespace embree
     /*! fast lookup table to detect invalid faces */
     mvector<char> invalid_face;
 
+    /*! view dependent level for each half edge */
+    mvector<float> adaptiveLevels;
+
+    /*! calculates the view dependent level of each half edge */
+    void calculateAdaptiveLevels();
+
     /*! test if face i is invalid in timestep j */
     __forceinline       char& invalidFace(size_t i, size_t j = 0)       { return invalid_face[i*numTimeSteps+j]; }
     __forceinline const char& invalidFace(size_t i, size_t j = 0) const { return invalid_face[i*numTimeSteps+j]; }
@@ -203,6 +203,12 @@ namespace embree
 #endif
 
     const int* valid = (const int*) valid_i;
+
+    /* large batches are evaluated patch by patch */
+    if (numUVs >= INTERPOLATE_SORT_THRESHOLD && numUVs <= 0xFFFFFFFF) {
+      interpolateSortedN(valid,primIDs,u,v,numUVs,buffer,P,dPdu,dPdv,ddPdudu,ddPdvdv,ddPdudv,numFloats);
+      return;
+    }
     
     for (size_t i=0; i<numUVs;) 
     {
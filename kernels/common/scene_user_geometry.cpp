@@ -131,6 +131,14 @@ namespace embree
     intersectors.intersectorN.intersect = intersect;
   }
 
+  void UserGeometry::setIntersectFunctionNM (RTCIntersectFuncNM intersect) 
+  {
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    intersectors.intersectorNM.intersect = intersect;
+  }
+
   void UserGeometry::setOccludedFunction (RTCOccludedFunc occluded1, bool ispc) 
   {
     if (parent->isStreamMode())
@@ -199,4 +207,12 @@ namespace embree
 
     intersectors.intersectorN.occluded = occluded;
   }
+
+  void UserGeometry::setOccludedFunctionNM (RTCOccludedFuncNM occluded) 
+  {
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    intersectors.intersectorNM.occluded = occluded;
+  }
 }
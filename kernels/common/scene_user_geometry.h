@@ -36,12 +36,14 @@ namespace embree
     virtual void setIntersectFunction16 (RTCIntersectFunc16 intersect16, bool ispc);
     virtual void setIntersectFunction1Mp (RTCIntersectFunc1Mp intersect);
     virtual void setIntersectFunctionN (RTCIntersectFuncN intersect);
+    virtual void setIntersectFunctionNM (RTCIntersectFuncNM intersect);
     virtual void setOccludedFunction (RTCOccludedFunc occluded, bool ispc);
     virtual void setOccludedFunction4 (RTCOccludedFunc4 occluded4, bool ispc);
     virtual void setOccludedFunction8 (RTCOccludedFunc8 occluded8, bool ispc);
     virtual void setOccludedFunction16 (RTCOccludedFunc16 occluded16, bool ispc);
     virtual void setOccludedFunction1Mp (RTCOccludedFunc1Mp occluded);
     virtual void setOccludedFunctionN (RTCOccludedFuncN occluded);
+    virtual void setOccludedFunctionNM (RTCOccludedFuncNM occluded);
     virtual void build() {}
   };
 }
@@ -72,6 +72,12 @@ namespace embree
     line_accel_mb = "default";
     line_builder_mb = "default";
     line_traverser_mb = "default";
+
+    point_accel = "default";
+    point_builder = "default";
+
+    point_accel_mb = "default";
+    point_builder_mb = "default";
     
     hair_accel = "default";
     hair_builder = "default";
@@ -307,6 +313,16 @@ namespace embree
         line_builder_mb = cin->get().Identifier();
       else if ((tok == Token::Id("line_traverser_mb")) && cin->trySymbol("="))
         line_traverser_mb = cin->get().Identifier();
+
+      else if ((tok == Token::Id("point_accel")) && cin->trySymbol("="))
+        point_accel = cin->get().Identifier();
+      else if ((tok == Token::Id("point_builder")) && cin->trySymbol("="))
+        point_builder = cin->get().Identifier();
+
+      else if ((tok == Token::Id("point_accel_mb")) && cin->trySymbol("="))
+        point_accel_mb = cin->get().Identifier();
+      else if ((tok == Token::Id("point_builder_mb")) && cin->trySymbol("="))
+        point_builder_mb = cin->get().Identifier();
       
       else if (tok == Token::Id("hair_accel") && cin->trySymbol("="))
         hair_accel = cin->get().Identifier();
@@ -432,6 +448,14 @@ namespace embree
     std::cout << "  accel         = " << line_accel_mb << std::endl;
     std::cout << "  builder       = " << line_builder_mb << std::endl;
     std::cout << "  traverser     = " << line_traverser_mb << std::endl;
+
+    std::cout << "points:" << std::endl;
+    std::cout << "  accel         = " << point_accel << std::endl;
+    std::cout << "  builder       = " << point_builder << std::endl;
+
+    std::cout << "motion blur points:" << std::endl;
+    std::cout << "  accel         = " << point_accel_mb << std::endl;
+    std::cout << "  builder       = " << point_builder_mb << std::endl;
     
     std::cout << "hair:" << std::endl;
     std::cout << "  accel         = " << hair_accel << std::endl;
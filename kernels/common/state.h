@@ -80,6 +80,14 @@ namespace embree
     std::string line_builder_mb;           //!< builder to use for motion blur line segments
     std::string line_traverser_mb;         //!< traverser to use for motion blur line segments
 
+  public:
+    std::string point_accel;                //!< acceleration structure to use for points
+    std::string point_builder;              //!< builder to use for points
+
+  public:
+    std::string point_accel_mb;             //!< acceleration structure to use for motion blur points
+    std::string point_builder_mb;           //!< builder to use for motion blur points
+
   public:
     std::string hair_accel;                //!< hair acceleration structure to use
     std::string hair_builder;              //!< builder to use for hair
@@ -21,6 +21,12 @@ namespace embree
   /*! invokes the memory monitor callback */
   struct MemoryMonitorInterface {
     virtual void memoryMonitor(ssize_t bytes, bool post) = 0;
+
+    /*! allocates large arrays directly from the OS, returns nullptr if the array should get aligned allocated */
+    virtual void* osMallocArray(size_t bytes) { return nullptr; }
+
+    /*! frees arrays allocated with osMallocArray, returns false for all other arrays */
+    virtual bool osFreeArray(void* ptr, size_t bytes) { return false; }
   };
 
   /*! allocator that performs aligned monitored allocations */
@@ -44,14 +50,10 @@ namespace embree
           assert(device);
           device->memoryMonitor(n*sizeof(T),false);
         }
-#if defined(__LINUX__) && defined(__AVX512ER__) // KNL
-        if (n*sizeof(value_type) >= 14 * PAGE_SIZE_2M)
-        {
-          pointer p =  (pointer) os_malloc(n*sizeof(value_type));
-          assert(p);
-          return p;
+        if (device) {
+          if (pointer p = (pointer) device->osMallocArray(n*sizeof(value_type)))
+            return p;
         }
-#endif
         return (pointer) alignedMalloc(n*sizeof(value_type),alignment);
       }
 
@@ -59,14 +61,8 @@ namespace embree
       {
         if (p)
         {
-#if defined(__LINUX__) && defined(__AVX512ER__) // KNL
-          if (n*sizeof(value_type) >= 14 * PAGE_SIZE_2M)
-            os_free(p,n*sizeof(value_type)); 
-          else
+          if (!device || !device->osFreeArray(p,n*sizeof(value_type)))
             alignedFree(p);
-#else
-          alignedFree(p);
-#endif
         }
         else assert(n == 0);
 
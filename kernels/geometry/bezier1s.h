@@ -0,0 +1,137 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "primitive.h"
+#include "bezier1v.h"
+
+namespace embree
+{
+  /*! Stores a hair curve pre-split into linear segments at build
+   *  time. The end points of the segments are stored in SoA layout,
+   *  such that SIMD many segments can get loaded without evaluating
+   *  the curve during traversal. Surface curves cannot get
+   *  approximated this way and store their control points instead. */
+  struct Bezier1s
+  {
+    struct Type : public PrimitiveType
+    {
+      Type ();
+      size_t size(const char* This) const;
+    };
+    static Type type;
+
+    /*! maximal number of stored segments, curves with higher tessellation rate get split into that many segments */
+    static const int MAX_SEGMENTS = 8;
+
+  public:
+
+    /* Returns maximal number of stored primitives */
+    static __forceinline size_t max_size() { return 1; }
+
+    /* Returns required number of primitive blocks for N primitives */
+    static __forceinline size_t blocks(size_t N) { return N; }
+
+  public:
+
+    /*! Default constructor. */
+    __forceinline Bezier1s () {}
+
+    /*! return primitive ID */
+    __forceinline unsigned int primID() const {
+      return prim;
+    }
+
+    /*! return geometry ID */
+    __forceinline unsigned int geomID() const {
+      return geom;
+    }
+
+    /*! returns the number of segments, 0 for surface curves */
+    __forceinline int numSegments() const {
+      return N;
+    }
+
+    /*! returns the i'th stored point */
+    __forceinline Vec3fa point(size_t i) const {
+      return Vec3fa(x[i],y[i],z[i],r[i]);
+    }
+
+    /*! gathers the start and end points of M segments starting with the i'th segment */
+    template<int M>
+      __forceinline void gather(Vec4<vfloat<M>>& p0, Vec4<vfloat<M>>& p1, int i) const
+    {
+      assert(i+M <= MAX_SEGMENTS);
+      p0 = Vec4<vfloat<M>>(vfloat<M>::loadu(&x[i+0]),vfloat<M>::loadu(&y[i+0]),vfloat<M>::loadu(&z[i+0]),vfloat<M>::loadu(&r[i+0]));
+      p1 = Vec4<vfloat<M>>(vfloat<M>::loadu(&x[i+1]),vfloat<M>::loadu(&y[i+1]),vfloat<M>::loadu(&z[i+1]),vfloat<M>::loadu(&r[i+1]));
+    }
+
+    /*! fill curve from curve list */
+    __forceinline void fill(const PrimRef* prims, size_t& i, size_t end, Scene* scene)
+    {
+      const PrimRef& ref = prims[i];
+      i++;
+      geom = ref.geomID();
+      prim = ref.primID();
+      const NativeCurves* curves = scene->get<NativeCurves>(geom);
+      const unsigned id = curves->curve(prim);
+      const Curve3fa curve(curves->vertex(id+0),curves->vertex(id+1),curves->vertex(id+2),curves->vertex(id+3));
+
+      /* surface curves keep their control points */
+      if (curves->subtype != NativeCurves::HAIR)
+      {
+        N = 0;
+        store(0,curve.v0); store(1,curve.v1); store(2,curve.v2); store(3,curve.v3);
+        for (int j=4; j<=MAX_SEGMENTS; j++) store(j,curve.v3);
+        return;
+      }
+
+      /* evaluate the curve the same way the bounds calculation does */
+      N = min(curves->tessellationRate,MAX_SEGMENTS);
+      for (int j=0; j<N; j+=4)
+      {
+        const Vec4vf4 p = curve.eval0<4>(j,N);
+        for (int k=0; k<4 && j+k<N; k++)
+          store(j+k,Vec3fa(p.x[k],p.y[k],p.z[k],p.w[k]));
+      }
+
+      /* all remaining points are the end point, which makes unused segments degenerated */
+      for (int j=N; j<=MAX_SEGMENTS; j++) store(j,curve.v3);
+    }
+
+    friend std::ostream& operator<<(std::ostream& cout, const Bezier1s& b)
+    {
+      cout << "Bezier1s { " << std::endl << " N = " << b.N << ", " << std::endl;
+      for (int i=0; i<=MAX_SEGMENTS; i++) cout << " p" << i << " = " << b.point(i) << ", " << std::endl;
+      return cout << " geomID = " << b.geomID() << ", primID = " << b.primID() << std::endl << "}";
+    }
+
+  private:
+    __forceinline void store(int i, const Vec3fa& p) {
+      x[i] = p.x; y[i] = p.y; z[i] = p.z; r[i] = p.w;
+    }
+
+  public:
+    float x[MAX_SEGMENTS+1];  //!< x coordinates of segment end points
+    float y[MAX_SEGMENTS+1];  //!< y coordinates of segment end points
+    float z[MAX_SEGMENTS+1];  //!< z coordinates of segment end points
+    float r[MAX_SEGMENTS+1];  //!< radii of segment end points
+    int N;                    //!< number of segments, 0 for surface curves
+    unsigned geom;            //!< geometry ID
+    unsigned prim;            //!< primitive ID
+  };
+}
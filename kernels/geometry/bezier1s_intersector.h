@@ -0,0 +1,193 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "bezier1s.h"
+#include "line_intersector.h"
+#include "bezier_curve_intersector.h"
+#include "intersector_epilog.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    /*! number of segments of a Bezier1s processed at once */
+#if defined(__AVX__)
+    static const int BEZIER1S_SIMD_WIDTH = 8;
+#else
+    static const int BEZIER1S_SIMD_WIDTH = 4;
+#endif
+
+    /*! Maps the u coordinate of a segment hit to the u coordinate along the curve. */
+    template<int M, typename Epilog>
+      struct Bezier1sEpilog
+    {
+      const Epilog& epilog;
+      const int i;
+      const float rcpN;
+
+      __forceinline Bezier1sEpilog(const Epilog& epilog, const int i, const int N)
+        : epilog(epilog), i(i), rcpN(1.0f/float(N)) {}
+
+      template<typename Hit>
+      __forceinline bool operator() (const vbool<M>& valid, Hit& hit) const
+      {
+        hit.vu = (vfloat<M>(step)+vfloat<M>(float(i))+hit.vu)*rcpN;
+        return epilog(valid,hit);
+      }
+    };
+
+    /*! Intersector for a single ray with a pre-split curve. */
+    struct Bezier1sIntersector1
+    {
+      typedef Bezier1s Primitive;
+      static const int M = BEZIER1S_SIMD_WIDTH;
+
+      struct PrecalculationsBase
+      {
+        __forceinline PrecalculationsBase() {}
+
+        __forceinline PrecalculationsBase(const Ray& ray, const void* ptr)
+          : intersectorLine(ray,ptr), intersectorCurve(ray,ptr) {}
+
+        typename LineIntersector1<M>::Precalculations intersectorLine;
+        BezierCurve1Intersector1<Curve3fa> intersectorCurve;
+      };
+
+      typedef Intersector1Precalculations<PrecalculationsBase> Precalculations;
+
+      static __forceinline void intersect(const Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& prim)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        const int N = prim.numSegments();
+        if (unlikely(N == 0)) {
+          pre.intersectorCurve.intersect(ray,prim.point(0),prim.point(1),prim.point(2),prim.point(3),Intersect1Epilog1<true>(ray,context,prim.geomID(),prim.primID()));
+          return;
+        }
+
+        for (int i=0; i<N; i+=M)
+        {
+          Vec4<vfloat<M>> p0,p1; prim.gather(p0,p1,i);
+          LineIntersector1<M>::intersect(ray,pre.intersectorLine,p0,p1,false,
+                                         Bezier1sEpilog<M,Intersect1EpilogMU<M,true>>(Intersect1EpilogMU<M,true>(ray,context,prim.geomID(),prim.primID()),i,N));
+        }
+      }
+
+      static __forceinline bool occluded(const Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& prim)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        const int N = prim.numSegments();
+        if (unlikely(N == 0))
+          return pre.intersectorCurve.intersect(ray,prim.point(0),prim.point(1),prim.point(2),prim.point(3),Occluded1Epilog1<true>(ray,context,prim.geomID(),prim.primID()));
+
+        for (int i=0; i<N; i+=M)
+        {
+          Vec4<vfloat<M>> p0,p1; prim.gather(p0,p1,i);
+          if (LineIntersector1<M>::intersect(ray,pre.intersectorLine,p0,p1,false,
+                                             Bezier1sEpilog<M,Occluded1EpilogMU<M,true>>(Occluded1EpilogMU<M,true>(ray,context,prim.geomID(),prim.primID()),i,N)))
+            return true;
+        }
+        return false;
+      }
+
+      /*! Intersect an array of rays with an array of M primitives. */
+      static __forceinline size_t intersect(Precalculations* pre, size_t valid, Ray** rays, IntersectContext* context,  size_t ty, const Primitive* prim, size_t num)
+      {
+        size_t valid_isec = 0;
+        do {
+          const size_t i = __bscf(valid);
+          const float old_far = rays[i]->tfar;
+          for (size_t n=0; n<num; n++)
+            intersect(pre[i],*rays[i],context,prim[n]);
+          valid_isec |= (rays[i]->tfar < old_far) ? ((size_t)1 << i) : 0;
+        } while(unlikely(valid));
+        return valid_isec;
+      }
+    };
+
+    /*! Intersector for a single ray from a ray packet with a pre-split curve. */
+    template<int K>
+      struct Bezier1sIntersectorK
+    {
+      typedef Bezier1s Primitive;
+      static const int M = BEZIER1S_SIMD_WIDTH;
+
+      struct PrecalculationsBase
+      {
+        __forceinline PrecalculationsBase(const vbool<K>& valid, const RayK<K>& ray)
+          : intersectorLine(valid,ray), intersectorCurve(valid,ray) {}
+
+        typename LineIntersectorK<M,K>::Precalculations intersectorLine;
+        BezierCurve1IntersectorK<Curve3fa,K> intersectorCurve;
+      };
+
+      typedef IntersectorKPrecalculations<K,PrecalculationsBase> Precalculations;
+
+      static __forceinline void intersect(Precalculations& pre, RayK<K>& ray, const size_t k, IntersectContext* context, const Primitive& prim)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        const int N = prim.numSegments();
+        if (unlikely(N == 0)) {
+          pre.intersectorCurve.intersect(ray,k,prim.point(0),prim.point(1),prim.point(2),prim.point(3),Intersect1KEpilog1<K,true>(ray,k,context,prim.geomID(),prim.primID()));
+          return;
+        }
+
+        for (int i=0; i<N; i+=M)
+        {
+          Vec4<vfloat<M>> p0,p1; prim.gather(p0,p1,i);
+          LineIntersectorK<M,K>::intersect(ray,k,pre.intersectorLine,p0,p1,false,
+                                           Bezier1sEpilog<M,Intersect1KEpilogMU<M,K,true>>(Intersect1KEpilogMU<M,K,true>(ray,k,context,prim.geomID(),prim.primID()),i,N));
+        }
+      }
+
+      static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& prim)
+      {
+        int mask = movemask(valid_i);
+        while (mask) intersect(pre,ray,__bscf(mask),context,prim);
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, RayK<K>& ray, const size_t k, IntersectContext* context, const Primitive& prim)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        const int N = prim.numSegments();
+        if (unlikely(N == 0))
+          return pre.intersectorCurve.intersect(ray,k,prim.point(0),prim.point(1),prim.point(2),prim.point(3),Occluded1KEpilog1<K,true>(ray,k,context,prim.geomID(),prim.primID()));
+
+        for (int i=0; i<N; i+=M)
+        {
+          Vec4<vfloat<M>> p0,p1; prim.gather(p0,p1,i);
+          if (LineIntersectorK<M,K>::intersect(ray,k,pre.intersectorLine,p0,p1,false,
+                                               Bezier1sEpilog<M,Occluded1KEpilogMU<M,K,true>>(Occluded1KEpilogMU<M,K,true>(ray,k,context,prim.geomID(),prim.primID()),i,N)))
+            return true;
+        }
+        return false;
+      }
+
+      static __forceinline vbool<K> occluded(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& prim)
+      {
+        vbool<K> valid_o = false;
+        int mask = movemask(valid_i);
+        while (mask) {
+          size_t k = __bscf(mask);
+          if (occluded(pre,ray,k,context,prim))
+            set(valid_o, k);
+        }
+        return valid_o;
+      }
+    };
+  }
+}
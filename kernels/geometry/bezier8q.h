@@ -0,0 +1,148 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+
+#pragma once
+
+#include "primitive.h"
+#include "bezier1v.h"
+
+namespace embree
+{
+  /*! Stores up to 8 curves with control points quantized to 16 bits
+   *  relative to the bounds of all control points of the block. */
+  struct Bezier8q
+  {
+    struct Type : public PrimitiveType {
+      Type ();
+      size_t size(const char* This) const;
+    };
+    static Type type;
+
+  public:
+
+    /* Maximal number of stored curves */
+    enum { M = 8 };
+
+    /* Returns maximal number of stored primitives */
+    static __forceinline size_t max_size() { return M; }
+
+    /* Returns required number of primitive blocks for N primitives */
+    static __forceinline size_t blocks(size_t N) { return (N+M-1)/M; }
+
+  public:
+
+    /*! Default constructor. */
+    __forceinline Bezier8q () {}
+
+    /*! returns the number of stored curves */
+    __forceinline size_t size() const 
+    {
+      size_t n = 0;
+      while (n<M && geomIDs[n] != unsigned(-1)) n++;
+      return n;
+    }
+
+    /*! returns geometry ID of curve i */
+    __forceinline unsigned geomID(size_t i) const { return geomIDs[i]; }
+
+    /*! returns primitive ID of curve i */
+    __forceinline unsigned primID(size_t i) const { return primIDs[i]; }
+
+    /*! fill curve block from curve list */
+    __forceinline void fill(const PrimRef* prims, size_t& begin, size_t end, Scene* scene)
+    {
+      /* gather control points and calculate their bounds including the radius */
+      Vec3fa v[M][4];
+      Vec3fa lower(pos_inf), upper(neg_inf);
+      size_t n = 0;
+      for (; n<M && begin<end; n++, begin++)
+      {
+        const PrimRef& prim = prims[begin];
+        const unsigned geomID = prim.geomID();
+        const unsigned primID = prim.primID();
+        const NativeCurves* curves = scene->get<NativeCurves>(geomID);
+        const unsigned id = curves->curve(primID);
+        for (size_t j=0; j<4; j++) {
+          v[n][j] = curves->vertex(id+j);
+          lower = min(lower,v[n][j]);
+          upper = max(upper,v[n][j]);
+        }
+        geomIDs[n] = geomID;
+        primIDs[n] = primID;
+      }
+
+      /* positions are rounded to the nearest step and move by at most
+       * posError, radii are enlarged by posError and rounded up, thus the
+       * quantized curves always enclose the original curves */
+      const float posError = maxPositionError(lower,upper);
+      offset = lower;
+      extent = upper-lower;
+      extent.w += posError;
+      const Vec3fa rcp_scale = Vec3fa(quantizationScale(extent.x),quantizationScale(extent.y),
+                                      quantizationScale(extent.z),quantizationScale(extent.w));
+      for (size_t i=0; i<M; i++)
+      {
+        for (size_t j=0; j<4; j++)
+        {
+          if (i >= n) { x[j][i] = y[j][i] = z[j][i] = r[j][i] = 0; continue; }
+          const Vec3fa q = (v[i][j]-offset)*rcp_scale;
+          x[j][i] = quantize(floorf(q.x+0.5f));
+          y[j][i] = quantize(floorf(q.y+0.5f));
+          z[j][i] = quantize(floorf(q.z+0.5f));
+          r[j][i] = quantize(ceilf ((v[i][j].w-offset.w+posError)*rcp_scale.w));
+        }
+      }
+      for (size_t i=n; i<M; i++) {
+        geomIDs[i] = unsigned(-1);
+        primIDs[i] = unsigned(-1);
+      }
+    }
+
+    /*! conservative distance by which quantized curves of a block
+     *  inside the given bounds can extend beyond these bounds, the
+     *  extents of such a block are at most sqrt(3) times the diagonal
+     *  of the (possibly oriented) bounds */
+    static __forceinline float quantizationError(const BBox3fa& bounds) {
+      return 8.0f*length(bounds.size())/65535.0f + 8.0f*float(ulp)*length(max(abs(bounds.lower),abs(bounds.upper)));
+    }
+
+  private:
+
+    /* maximal distance a control point moves through quantization and dequantization */
+    static __forceinline float maxPositionError(const Vec3fa& lower, const Vec3fa& upper) {
+      return 0.5f*length(upper-lower)/65535.0f + 4.0f*float(ulp)*length(max(abs(lower),abs(upper)));
+    }
+
+    static __forceinline float quantizationScale(const float extent) {
+      return extent > 0.0f ? 65535.0f/extent : 0.0f;
+    }
+
+    static __forceinline unsigned short quantize(const float q) {
+      return (unsigned short) clamp(q,0.0f,65535.0f);
+    }
+
+  public:
+    Vec3fa offset;                //!< lower bounds of all control points (x,y,z,r)
+    Vec3fa extent;                //!< size of the quantization range (x,y,z,r)
+    unsigned short x[4][M];       //!< quantized x coordinates of the 4 control points of each curve
+    unsigned short y[4][M];       //!< quantized y coordinates of the 4 control points of each curve
+    unsigned short z[4][M];       //!< quantized z coordinates of the 4 control points of each curve
+    unsigned short r[4][M];       //!< quantized radii of the 4 control points of each curve
+    unsigned geomIDs[M];          //!< geometry IDs, -1 marks unused slots
+    unsigned primIDs[M];          //!< primitive IDs
+  };
+}
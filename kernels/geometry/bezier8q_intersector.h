@@ -0,0 +1,215 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "bezier8q.h"
+#include "bezier_hair_intersector.h"
+#include "bezier_curve_intersector.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    /*! Dequantizes the control points of all curves of a block using SIMD instructions. */
+    struct Bezier8qCurves
+    {
+      __forceinline Bezier8qCurves (const Bezier8q& prim)
+      {
+        const vfloat8 ox(prim.offset.x), oy(prim.offset.y), oz(prim.offset.z), ow(prim.offset.w);
+        const vfloat8 ex(prim.extent.x), ey(prim.extent.y), ez(prim.extent.z), ew(prim.extent.w);
+        for (size_t j=0; j<4; j++) {
+          vfloat8::store(x[j],madd(vfloat8::load(prim.x[j]),ex,ox));
+          vfloat8::store(y[j],madd(vfloat8::load(prim.y[j]),ey,oy));
+          vfloat8::store(z[j],madd(vfloat8::load(prim.z[j]),ez,oz));
+          vfloat8::store(r[j],madd(vfloat8::load(prim.r[j]),ew,ow));
+        }
+      }
+
+      /*! returns control point j of curve i */
+      __forceinline Vec3fa vertex(size_t i, size_t j) const {
+        return Vec3fa(x[j][i],y[j][i],z[j][i],r[j][i]);
+      }
+
+      __aligned(32) float x[4][Bezier8q::M];
+      __aligned(32) float y[4][Bezier8q::M];
+      __aligned(32) float z[4][Bezier8q::M];
+      __aligned(32) float r[4][Bezier8q::M];
+    };
+
+    /*! Intersector for a single ray with a block of quantized bezier curves. */
+    struct Bezier8qIntersector1
+    {
+      typedef Bezier8q Primitive;
+
+      struct PrecalculationsBase
+      {
+        __forceinline PrecalculationsBase() {}
+
+        __forceinline PrecalculationsBase(const Ray& ray, const void* ptr)
+          : intersectorHair(ray,ptr), intersectorCurve(ray,ptr) {}
+
+        Bezier1Intersector1<Curve3fa> intersectorHair;
+        BezierCurve1Intersector1<Curve3fa> intersectorCurve;
+      };
+
+      typedef Intersector1Precalculations<PrecalculationsBase> Precalculations;
+      
+      static __forceinline void intersect(const Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& prim)
+      {
+        const Bezier8qCurves curves(prim);
+        for (size_t i=0; i<Bezier8q::M; i++)
+        {
+          const unsigned geomID = prim.geomID(i);
+          const unsigned primID = prim.primID(i);
+          if (geomID == unsigned(-1)) break;
+          STAT3(normal.trav_prims,1,1,1);
+          const Vec3fa p0 = curves.vertex(i,0), p1 = curves.vertex(i,1), p2 = curves.vertex(i,2), p3 = curves.vertex(i,3);
+          const NativeCurves* geom = (NativeCurves*)context->scene->get(geomID);
+          if (likely(geom->subtype == NativeCurves::HAIR))
+            pre.intersectorHair.intersect(ray,p0,p1,p2,p3,geom->tessellationRate,Intersect1EpilogMU<VSIZEX,true>(ray,context,geomID,primID));
+          else 
+            pre.intersectorCurve.intersect(ray,p0,p1,p2,p3,Intersect1Epilog1<true>(ray,context,geomID,primID));
+        }
+      }
+      
+      static __forceinline bool occluded(const Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& prim)
+      {
+        const Bezier8qCurves curves(prim);
+        for (size_t i=0; i<Bezier8q::M; i++)
+        {
+          const unsigned geomID = prim.geomID(i);
+          const unsigned primID = prim.primID(i);
+          if (geomID == unsigned(-1)) break;
+          STAT3(shadow.trav_prims,1,1,1);
+          const Vec3fa p0 = curves.vertex(i,0), p1 = curves.vertex(i,1), p2 = curves.vertex(i,2), p3 = curves.vertex(i,3);
+          const NativeCurves* geom = (NativeCurves*)context->scene->get(geomID);
+          if (likely(geom->subtype == NativeCurves::HAIR)) {
+            if (pre.intersectorHair.intersect(ray,p0,p1,p2,p3,geom->tessellationRate,Occluded1EpilogMU<VSIZEX,true>(ray,context,geomID,primID)))
+              return true;
+          } else {
+            if (pre.intersectorCurve.intersect(ray,p0,p1,p2,p3,Occluded1Epilog1<true>(ray,context,geomID,primID)))
+              return true;
+          }
+        }
+        return false;
+      }
+
+      /*! Intersect an array of rays with an array of M primitives. */
+      static __forceinline size_t intersect(Precalculations* pre, size_t valid, Ray** rays, IntersectContext* context,  size_t ty, const Primitive* prim, size_t num)
+      {
+        size_t valid_isec = 0;
+        do {
+          const size_t i = __bscf(valid);
+          const float old_far = rays[i]->tfar;
+          for (size_t n=0; n<num; n++)
+            intersect(pre[i],*rays[i],context,prim[n]);
+          valid_isec |= (rays[i]->tfar < old_far) ? ((size_t)1 << i) : 0;            
+        } while(unlikely(valid));
+        return valid_isec;
+      }
+    };
+
+    /*! Intersector for a single ray from a ray packet with a block of quantized bezier curves. */
+    template<int K>
+      struct Bezier8qIntersectorK
+    {
+      typedef Bezier8q Primitive;
+
+      struct PrecalculationsBase
+      {
+        __forceinline PrecalculationsBase() {}
+
+        __forceinline PrecalculationsBase(const vbool<K>& valid, const RayK<K>& ray)
+          : intersectorHair(valid,ray), intersectorCurve(valid,ray) {}
+
+        __forceinline PrecalculationsBase(const RayK<K>& ray, size_t k)
+          : intersectorHair(ray,k), intersectorCurve(ray,k) {}
+
+        Bezier1IntersectorK<Curve3fa,K> intersectorHair;
+        BezierCurve1IntersectorK<Curve3fa,K> intersectorCurve;
+      };
+
+      typedef IntersectorKPrecalculations<K,PrecalculationsBase> Precalculations;
+
+      static __forceinline void intersect(Precalculations& pre, RayK<K>& ray, const size_t k, IntersectContext* context, const Bezier8qCurves& curves, const Primitive& prim) 
+      {
+        for (size_t i=0; i<Bezier8q::M; i++)
+        {
+          const unsigned geomID = prim.geomID(i);
+          const unsigned primID = prim.primID(i);
+          if (geomID == unsigned(-1)) break;
+          STAT3(normal.trav_prims,1,1,1);
+          const Vec3fa p0 = curves.vertex(i,0), p1 = curves.vertex(i,1), p2 = curves.vertex(i,2), p3 = curves.vertex(i,3);
+          const NativeCurves* geom = (NativeCurves*)context->scene->get(geomID);
+          if (likely(geom->subtype == NativeCurves::HAIR))
+            pre.intersectorHair.intersect(ray,k,p0,p1,p2,p3,geom->tessellationRate,Intersect1KEpilogMU<VSIZEX,K,true>(ray,k,context,geomID,primID));
+          else
+            pre.intersectorCurve.intersect(ray,k,p0,p1,p2,p3,Intersect1KEpilog1<K,true>(ray,k,context,geomID,primID));
+        }
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, RayK<K>& ray, const size_t k, IntersectContext* context, const Bezier8qCurves& curves, const Primitive& prim) 
+      {
+        for (size_t i=0; i<Bezier8q::M; i++)
+        {
+          const unsigned geomID = prim.geomID(i);
+          const unsigned primID = prim.primID(i);
+          if (geomID == unsigned(-1)) break;
+          STAT3(shadow.trav_prims,1,1,1);
+          const Vec3fa p0 = curves.vertex(i,0), p1 = curves.vertex(i,1), p2 = curves.vertex(i,2), p3 = curves.vertex(i,3);
+          const NativeCurves* geom = (NativeCurves*)context->scene->get(geomID);
+          if (likely(geom->subtype == NativeCurves::HAIR)) {
+            if (pre.intersectorHair.intersect(ray,k,p0,p1,p2,p3,geom->tessellationRate,Occluded1KEpilogMU<VSIZEX,K,true>(ray,k,context,geomID,primID)))
+              return true;
+          } else {
+            if (pre.intersectorCurve.intersect(ray,k,p0,p1,p2,p3,Occluded1KEpilog1<K,true>(ray,k,context,geomID,primID)))
+              return true;
+          }
+        }
+        return false;
+      }
+      
+      static __forceinline void intersect(Precalculations& pre, RayK<K>& ray, const size_t k, IntersectContext* context, const Primitive& prim) {
+        intersect(pre,ray,k,context,Bezier8qCurves(prim),prim);
+      }
+
+      static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& prim)
+      {
+        const Bezier8qCurves curves(prim);
+        int mask = movemask(valid_i);
+        while (mask) intersect(pre,ray,__bscf(mask),context,curves,prim);
+      }
+ 
+      static __forceinline bool occluded(Precalculations& pre, RayK<K>& ray, const size_t k, IntersectContext* context, const Primitive& prim) {
+        return occluded(pre,ray,k,context,Bezier8qCurves(prim),prim);
+      }
+
+      static __forceinline vbool<K> occluded(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& prim)
+      {
+        const Bezier8qCurves curves(prim);
+        vbool<K> valid_o = false;
+        int mask = movemask(valid_i);
+        while (mask) {
+          size_t k = __bscf(mask);
+          if (occluded(pre,ray,k,context,curves,prim))
+            set(valid_o, k);
+        }
+        return valid_o;
+      }
+    };
+  }
+}
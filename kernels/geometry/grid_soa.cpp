@@ -45,11 +45,7 @@ namespace embree
                  local_grid_x,local_grid_y,local_grid_z,local_grid_u,local_grid_v,geom);
         
         /* encode UVs */
-        for (unsigned i=0; i<dim_offset; i+=VSIZEX) {
-          const vintx iu = (vintx) clamp(vfloatx::load(&local_grid_u[i])*0xFFFF, vfloatx(0.0f), vfloatx(0xFFFF));
-          const vintx iv = (vintx) clamp(vfloatx::load(&local_grid_v[i])*0xFFFF, vfloatx(0.0f), vfloatx(0xFFFF));
-          vintx::storeu(&local_grid_uv[i], (iv << 16) | iu);
-        }
+        encodeUVs(local_grid_u,local_grid_v,local_grid_uv,dim_offset);
 
         /* copy temporary data to compact grid */
         float* const grid_x  = (float*)(gridData(t) + 0*dim_offset);
@@ -89,6 +85,30 @@ namespace embree
       }
     }
 
+    GridSOA::GridSOA(const SubdivPatch1Base* patch, const unsigned width, const unsigned height,
+                     const float* grid_x, const float* grid_y, const float* grid_z, const float* grid_uv, const unsigned stride,
+                     const size_t bvhBytes, const size_t gridBytes, BBox3fa* bounds_o)
+      : align0(0),
+        time_steps_global(1), time_steps(1), width(width), height(height), dim_offset(width*height),
+        geomID(patch->geom), primID(patch->prim),
+        bvhBytes(unsigned(bvhBytes)), gridOffset(unsigned(bvhBytes)), gridBytes(unsigned(gridBytes)), rootOffset(unsigned(gridOffset+gridBytes))
+    {
+      /* copy sub range of the evaluated grid to compact grid */
+      float* const dst_x  = gridData(0) + 0*dim_offset;
+      float* const dst_y  = gridData(0) + 1*dim_offset;
+      float* const dst_z  = gridData(0) + 2*dim_offset;
+      float* const dst_uv = gridData(0) + 3*dim_offset;
+      for (unsigned y=0; y<height; y++)
+      {
+        memcpy(dst_x +y*width, grid_x +y*stride, width*sizeof(float));
+        memcpy(dst_y +y*width, grid_y +y*stride, width*sizeof(float));
+        memcpy(dst_z +y*width, grid_z +y*stride, width*sizeof(float));
+        memcpy(dst_uv+y*width, grid_uv+y*stride, width*sizeof(float));
+      }
+
+      root(0) = buildBVH(0,bounds_o);
+    }
+
     size_t GridSOA::getBVHBytes(const GridRange& range, const size_t nodeBytes, const size_t leafBytes)
     {
       if (range.hasLeafSize()) 
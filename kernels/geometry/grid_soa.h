@@ -37,6 +37,11 @@ namespace embree
               const unsigned x0, const unsigned x1, const unsigned y0, const unsigned y1, const unsigned swidth, const unsigned sheight,
               const SubdivMesh* const geom, const size_t bvhBytes, const size_t gridBytes, BBox3fa* bounds_o = nullptr);
 
+      /*! GridSOA constructor from an already evaluated grid with stride floats per line */
+      GridSOA(const SubdivPatch1Base* patch, const unsigned width, const unsigned height,
+              const float* grid_x, const float* grid_y, const float* grid_z, const float* grid_uv, const unsigned stride,
+              const size_t bvhBytes, const size_t gridBytes, BBox3fa* bounds_o = nullptr);
+
       /*! Subgrid creation */
       template<typename Allocator>
         static GridSOA* create(const SubdivPatch1Base* patches, const unsigned time_steps, const unsigned time_steps_global,
@@ -66,6 +71,34 @@ namespace embree
         return create(patches,time_steps,time_steps_global,0,patches->grid_u_res-1,0,patches->grid_v_res-1,scene,alloc,bounds_o);
       }
 
+      /*! Subgrid creation from an already evaluated grid, used to share one patch evaluation between many subgrids */
+      template<typename Allocator>
+        static GridSOA* create(const SubdivPatch1Base* patch, const unsigned width, const unsigned height,
+                               const float* grid_x, const float* grid_y, const float* grid_z, const float* grid_uv, const unsigned stride,
+                               Allocator& alloc, BBox3fa* bounds_o = nullptr)
+      {
+        const GridRange range(0,width-1,0,height-1);
+        const size_t bvhBytes  = getBVHBytes(range,sizeof(BVH4::AlignedNode),0);
+        const size_t gridBytes = 4*size_t(width)*size_t(height)*sizeof(float);
+        size_t rootBytes = sizeof(BVH4::NodeRef);
+#if !defined(__X86_64__)
+        rootBytes += 4; // see above
+#endif
+        void* data = alloc(offsetof(GridSOA,data)+bvhBytes+gridBytes+rootBytes);
+        assert(data);
+        return new (data) GridSOA(patch,width,height,grid_x,grid_y,grid_z,grid_uv,stride,bvhBytes,gridBytes,bounds_o);
+      }
+
+      /*! encodes N UVs into 16 bit fixed point, arrays have to be padded to a multiple of the SIMD width */
+      static __forceinline void encodeUVs(const float* grid_u, const float* grid_v, float* grid_uv, const unsigned N)
+      {
+        for (unsigned i=0; i<N; i+=VSIZEX) {
+          const vintx iu = (vintx) clamp(vfloatx::load(&grid_u[i])*0xFFFF, vfloatx(0.0f), vfloatx(0xFFFF));
+          const vintx iv = (vintx) clamp(vfloatx::load(&grid_v[i])*0xFFFF, vfloatx(0.0f), vfloatx(0xFFFF));
+          vintx::storeu(&grid_uv[i], (iv << 16) | iu);
+        }
+      }
+
        /*! returns reference to root */
       __forceinline       BVH4::NodeRef& root(size_t t = 0)       { return (BVH4::NodeRef&)data[rootOffset + t*sizeof(BVH4::NodeRef)]; }
       __forceinline const BVH4::NodeRef& root(size_t t = 0) const { return (BVH4::NodeRef&)data[rootOffset + t*sizeof(BVH4::NodeRef)]; }
@@ -44,6 +44,77 @@ namespace embree
         Vec3<vfloat<M>> vNg;
       };
     
+    /*! Intersects M rays with M round line segments, each consisting
+     *  of a cone between the end points that is capped by a sphere at
+     *  each end point. Returns the closest hit in the (tnear,tfar)
+     *  interval together with the parametric hit location u along the
+     *  segment and the unnormalized surface normal. */
+    template<int M>
+      __forceinline vbool<M> intersectRoundLines(const Vec3<vfloat<M>>& org, const Vec3<vfloat<M>>& dir, const vfloat<M>& tnear, const vfloat<M>& tfar,
+                                                 const Vec4<vfloat<M>>& v0, const Vec4<vfloat<M>>& v1,
+                                                 vfloat<M>& u_o, vfloat<M>& t_o, Vec3<vfloat<M>>& Ng_o)
+    {
+      typedef Vec3<vfloat<M>> Vec3vfM;
+      const vfloat<M> dd = dot(dir,dir);
+
+      /* intersect cone, the radius grows linearly with the projection s onto the axis */
+      const Vec3vfM a = v1.xyz()-v0.xyz();
+      const Vec3vfM w = org-v0.xyz();
+      const vfloat<M> L2 = dot(a,a);
+      const vfloat<M> dr = v1.w-v0.w;
+      const vfloat<M> rL2 = rcp(L2);
+      const vfloat<M> s0 = dot(w,a)*rL2;
+      const vfloat<M> s1 = dot(dir,a)*rL2;
+      const vfloat<M> q0 = madd(dr,s0,v0.w);
+      const vfloat<M> q1 = dr*s1;
+      const vfloat<M> A = dd - L2*s1*s1 - q1*q1;
+      const vfloat<M> B = dot(w,dir) - L2*s0*s1 - q0*q1;
+      const vfloat<M> C = dot(w,w) - L2*s0*s0 - q0*q0;
+      const vfloat<M> D = B*B - A*C;
+      const vbool<M> valid_cone = (D >= 0.0f) & (L2 > 0.0f) & (A != 0.0f);
+      const vfloat<M> Q = sqrt(max(D,vfloat<M>(zero)));
+      const vfloat<M> tc0 = (-B-Q)/A;
+      const vfloat<M> tc1 = (-B+Q)/A;
+
+      vfloat<M> t = inf, u = zero;
+      Vec3vfM Ng(zero);
+
+      auto hitCone = [&] (const vfloat<M>& tc) {
+        const vfloat<M> s = madd(s1,tc,s0);
+        const vfloat<M> r = madd(q1,tc,q0);
+        const vbool<M> valid = valid_cone & (s >= 0.0f) & (s <= 1.0f) & (r >= 0.0f) & (tnear < tc) & (tc < tfar) & (tc < t);
+        const Vec3vfM P = madd(Vec3vfM(tc),dir,w);
+        t = select(valid,tc,t);
+        u = select(valid,s,u);
+        Ng = select(valid,P-(s+r*dr*rL2)*a,Ng);
+      };
+      hitCone(min(tc0,tc1));
+      hitCone(max(tc0,tc1));
+
+      /* intersect spheres at both end points */
+      auto hitSphere = [&] (const Vec4<vfloat<M>>& c, const vfloat<M>& uc) {
+        const Vec3vfM ws = org-c.xyz();
+        const vfloat<M> Bs = dot(ws,dir);
+        const vfloat<M> Cs = dot(ws,ws) - c.w*c.w;
+        const vfloat<M> Ds = Bs*Bs - dd*Cs;
+        const vfloat<M> Qs = sqrt(max(Ds,vfloat<M>(zero)));
+        const vfloat<M> ts0 = (-Bs-Qs)/dd;
+        const vfloat<M> ts1 = (-Bs+Qs)/dd;
+        const vfloat<M> ts = select(tnear < ts0,ts0,ts1);
+        const vbool<M> valid = (Ds >= 0.0f) & (tnear < ts) & (ts < tfar) & (ts < t);
+        t = select(valid,ts,t);
+        u = select(valid,uc,u);
+        Ng = select(valid,madd(Vec3vfM(ts),dir,ws),Ng);
+      };
+      hitSphere(v0,vfloat<M>(zero));
+      hitSphere(v1,vfloat<M>(one));
+
+      u_o = u;
+      t_o = t;
+      Ng_o = Ng;
+      return t != vfloat<M>(inf);
+    }
+
     template<int M>
       struct LineIntersector1
       {
@@ -67,7 +138,7 @@ namespace embree
         
         template<typename Epilog>
         static __forceinline bool intersect(Ray& ray, const Precalculations& pre,
-                                            const Vec4vfM& v0, const Vec4vfM& v1,
+                                            const Vec4vfM& v0, const Vec4vfM& v1, const vbool<M>& round,
                                             const Epilog& epilog)
         {
           /* transform end points into ray space */
@@ -79,18 +150,29 @@ namespace embree
           const Vec4vfM w = -p0;
           const vfloat<M> d0 = madd(w.x,v.x,w.y*v.y);
           const vfloat<M> d1 = madd(v.x,v.x,v.y*v.y);
-          const vfloat<M> u = clamp(d0*rcp(d1),vfloat<M>(zero),vfloat<M>(one));
+          vfloat<M> u = clamp(d0*rcp(d1),vfloat<M>(zero),vfloat<M>(one));
           const Vec4vfM p = madd(u,v,p0);
-          const vfloat<M> t = p.z*pre.depth_scale;
+          vfloat<M> t = p.z*pre.depth_scale;
           const vfloat<M> d2 = madd(p.x,p.x,p.y*p.y);
           const vfloat<M> r = p.w;
           const vfloat<M> r2 = r*r;
-          vbool<M> valid = (d2 <= r2) & (vfloat<M>(ray.tnear) < t) & (t < vfloat<M>(ray.tfar));
-          if (unlikely(none(valid))) return false;
+          vbool<M> valid = (d2 <= r2) & (vfloat<M>(ray.tnear) < t) & (t < vfloat<M>(ray.tfar)) & !round;
+          if (unlikely(none(valid | round))) return false;
           
           /* ignore denormalized segments */
-          const Vec3vfM T = v1.xyz()-v0.xyz();
+          Vec3vfM T = v1.xyz()-v0.xyz();
           valid &= (T.x != vfloat<M>(zero)) | (T.y != vfloat<M>(zero)) | (T.z != vfloat<M>(zero));
+
+          /* exact intersection with round line segments */
+          if (unlikely(any(round)))
+          {
+            vfloat<M> ur, tr; Vec3vfM Ngr;
+            const vbool<M> valid_round = round & intersectRoundLines(Vec3vfM(ray.org),Vec3vfM(ray.dir),vfloat<M>(ray.tnear),vfloat<M>(ray.tfar),v0,v1,ur,tr,Ngr);
+            u = select(round,ur,u);
+            t = select(round,tr,t);
+            T = select(round,Ngr,T);
+            valid |= valid_round;
+          }
           if (unlikely(none(valid))) return false;
           
           /* update hit information */
@@ -123,7 +205,7 @@ namespace embree
         
         template<typename Epilog>
         static __forceinline bool intersect(RayK<K>& ray, size_t k, const Precalculations& pre,
-                                            const Vec4vfM& v0, const Vec4vfM& v1,
+                                            const Vec4vfM& v0, const Vec4vfM& v1, const vbool<M>& round,
                                             const Epilog& epilog)
         {
           /* transform end points into ray space */
@@ -137,18 +219,29 @@ namespace embree
           const Vec4vfM w = -p0;
           const vfloat<M> d0 = madd(w.x,v.x,w.y*v.y);
           const vfloat<M> d1 = madd(v.x,v.x,v.y*v.y);
-          const vfloat<M> u = clamp(d0*rcp(d1),vfloat<M>(zero),vfloat<M>(one));
+          vfloat<M> u = clamp(d0*rcp(d1),vfloat<M>(zero),vfloat<M>(one));
           const Vec4vfM p = madd(u,v,p0);
-          const vfloat<M> t = p.z*pre.depth_scale[k];
+          vfloat<M> t = p.z*pre.depth_scale[k];
           const vfloat<M> d2 = madd(p.x,p.x,p.y*p.y);
           const vfloat<M> r = p.w;
           const vfloat<M> r2 = r*r;
-          vbool<M> valid = (d2 <= r2) & (vfloat<M>(ray.tnear[k]) < t) & (t < vfloat<M>(ray.tfar[k]));
-          if (unlikely(none(valid))) return false;
+          vbool<M> valid = (d2 <= r2) & (vfloat<M>(ray.tnear[k]) < t) & (t < vfloat<M>(ray.tfar[k])) & !round;
+          if (unlikely(none(valid | round))) return false;
           
           /* ignore denormalized segments */
-          const Vec3vfM T = v1.xyz()-v0.xyz();
+          Vec3vfM T = v1.xyz()-v0.xyz();
           valid &= (T.x != vfloat<M>(zero)) | (T.y != vfloat<M>(zero)) | (T.z != vfloat<M>(zero));
+
+          /* exact intersection with round line segments */
+          if (unlikely(any(round)))
+          {
+            vfloat<M> ur, tr; Vec3vfM Ngr;
+            const vbool<M> valid_round = round & intersectRoundLines(ray_org,ray_dir,vfloat<M>(ray.tnear[k]),vfloat<M>(ray.tfar[k]),v0,v1,ur,tr,Ngr);
+            u = select(round,ur,u);
+            t = select(round,tr,t);
+            T = select(round,Ngr,T);
+            valid |= valid_round;
+          }
           if (unlikely(none(valid))) return false;
           
           /* update hit information */
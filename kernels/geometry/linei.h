@@ -67,6 +67,16 @@ namespace embree
     __forceinline vint<M> primID() const { return primIDs; }
     __forceinline int primID(const size_t i) const { assert(i<M); return primIDs[i]; }
 
+    /* Returns a mask of the round line segments */
+    template<int Mx>
+    __forceinline vbool<Mx> round(const Scene* scene) const
+    {
+      int mask = 0;
+      for (size_t i=0; i<M && valid(i); i++)
+        if (scene->get<LineSegments>(geomID(i))->subtype == LineSegments::ROUND) mask |= 1 << i;
+      return vbool<Mx>(mask);
+    }
+
     /* gather the line segments */
     __forceinline void gather(Vec4<vfloat<M>>& p0,
                               Vec4<vfloat<M>>& p1,
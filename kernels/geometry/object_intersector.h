@@ -17,6 +17,7 @@
 #pragma once
 
 #include "object.h"
+#include "intersector_iterators.h"
 #include "../common/ray.h"
 
 namespace embree
@@ -216,6 +217,157 @@ namespace embree
       }
     };
 
+    /*! maximal number of items passed to a single leaf callback */
+    static const size_t MAX_OBJECT_LEAF_ITEMS = 16;
+
+    /*! collects the IDs of consecutive objects of the same geometry, starting at object i */
+    __forceinline size_t gatherObjectItems(const Object* prims, size_t i, size_t num, unsigned* items)
+    {
+      size_t M = 0;
+      const unsigned geomID = prims[i].geomID;
+      for (; i<num && M<MAX_OBJECT_LEAF_ITEMS && prims[i].geomID == geomID; i++)
+        items[M++] = prims[i].primID;
+      return M;
+    }
+
+    /*! Intersects all objects of a leaf with a single ray. Consecutive
+     *  objects of a geometry with leaf callbacks get intersected with a
+     *  single callback invocation. */
+    template<bool mblur>
+      struct ObjectArrayIntersector1 : public ArrayIntersector1<ObjectIntersector1<mblur>>
+    {
+      typedef ArrayIntersector1<ObjectIntersector1<mblur>> Base;
+      typedef Object Primitive;
+      typedef typename ObjectIntersector1<mblur>::Precalculations Precalculations;
+      using Base::intersect;
+      using Base::occluded;
+
+      static __forceinline void intersect(Precalculations& pre, Ray& ray, IntersectContext* context, size_t ty, const Primitive* prims, size_t num, size_t& lazy_node)
+      {
+        for (size_t i=0; i<num; )
+        {
+          AccelSet* accel = (AccelSet*) context->scene->get(prims[i].geomID);
+          if (likely(!accel->intersectors.intersectorNM.intersect)) {
+            ObjectIntersector1<mblur>::intersect(pre,ray,context,prims[i++]);
+            continue;
+          }
+          unsigned items[MAX_OBJECT_LEAF_ITEMS];
+          const size_t M = gatherObjectItems(prims,i,num,items);
+          i += M;
+
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          if ((ray.mask & accel->mask) == 0) 
+            continue;
+#endif
+          AVX_ZERO_UPPER();
+          int mask = -1;
+          accel->intersectNM(&mask,(RTCRayN*)&ray,1,items,M,context);
+        }
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, Ray& ray, IntersectContext* context, size_t ty, const Primitive* prims, size_t num, size_t& lazy_node) 
+      {
+        for (size_t i=0; i<num; )
+        {
+          AccelSet* accel = (AccelSet*) context->scene->get(prims[i].geomID);
+          if (likely(!accel->intersectors.intersectorNM.occluded)) {
+            if (ObjectIntersector1<mblur>::occluded(pre,ray,context,prims[i++]))
+              return true;
+            continue;
+          }
+          unsigned items[MAX_OBJECT_LEAF_ITEMS];
+          const size_t M = gatherObjectItems(prims,i,num,items);
+          i += M;
+
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          if ((ray.mask & accel->mask) == 0) 
+            continue;
+#endif
+          AVX_ZERO_UPPER();
+          int mask = -1;
+          accel->occludedNM(&mask,(RTCRayN*)&ray,1,items,M,context);
+          if (ray.geomID == 0) return true;
+        }
+        return false;
+      }
+    };
+
+    /*! Intersects all objects of a leaf with a ray packet. Consecutive
+     *  objects of a geometry with leaf callbacks get intersected with a
+     *  single callback invocation. */
+    template<int K, bool mblur>
+      struct ObjectArrayIntersectorK : public ArrayIntersectorK_1<K,ObjectIntersectorK<K,mblur>>
+    {
+      typedef Object Primitive;
+      typedef typename ObjectIntersectorK<K,mblur>::Precalculations Precalculations;
+
+      static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive* prims, size_t num, size_t& lazy_node)
+      {
+        for (size_t i=0; i<num; )
+        {
+          AccelSet* accel = (AccelSet*) context->scene->get(prims[i].geomID);
+          if (likely(!accel->intersectors.intersectorNM.intersect)) {
+            ObjectIntersectorK<K,mblur>::intersect(valid_i,pre,ray,context,prims[i++]);
+            continue;
+          }
+          unsigned items[MAX_OBJECT_LEAF_ITEMS];
+          const size_t M = gatherObjectItems(prims,i,num,items);
+          i += M;
+
+          vbool<K> valid = valid_i;
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          valid &= (ray.mask & accel->mask) != 0;
+          if (none(valid)) continue;
+#endif
+          AVX_ZERO_UPPER();
+          vint<K> mask = valid.mask32();
+          accel->intersectNM((int*)&mask,(RTCRayN*)&ray,K,items,M,context);
+        }
+      }
+
+      static __forceinline vbool<K> occluded(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive* prims, size_t num, size_t& lazy_node) 
+      {
+        vbool<K> valid0 = valid_i;
+        for (size_t i=0; i<num; )
+        {
+          AccelSet* accel = (AccelSet*) context->scene->get(prims[i].geomID);
+          if (likely(!accel->intersectors.intersectorNM.occluded)) {
+            valid0 &= !ObjectIntersectorK<K,mblur>::occluded(valid0,pre,ray,context,prims[i++]);
+            if (none(valid0)) break;
+            continue;
+          }
+          unsigned items[MAX_OBJECT_LEAF_ITEMS];
+          const size_t M = gatherObjectItems(prims,i,num,items);
+          i += M;
+
+          vbool<K> valid = valid0;
+          /* perform ray mask test */
+#if defined(EMBREE_RAY_MASK)
+          valid &= (ray.mask & accel->mask) != 0;
+          if (none(valid)) continue;
+#endif
+          AVX_ZERO_UPPER();
+          vint<K> mask = valid.mask32();
+          accel->occludedNM((int*)&mask,(RTCRayN*)&ray,K,items,M,context);
+          valid0 &= !(valid & (ray.geomID == 0));
+          if (none(valid0)) break;
+        }
+        return !valid0;
+      }
+
+      static __forceinline void intersect(Precalculations& pre, RayK<K>& ray, size_t k, IntersectContext* context, const Primitive* prims, size_t num, size_t& lazy_node) {
+        intersect(vbool<K>(1<<int(k)),pre,ray,context,prims,num,lazy_node);
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, RayK<K>& ray, size_t k, IntersectContext* context, const Primitive* prims, size_t num, size_t& lazy_node) {
+        occluded(vbool<K>(1<<int(k)),pre,ray,context,prims,num,lazy_node);
+        return ray.geomID[k] == 0;
+      }
+    };
+
     typedef ObjectIntersectorK<4,false>  ObjectIntersector4;
     typedef ObjectIntersectorK<8,false>  ObjectIntersector8;
     typedef ObjectIntersectorK<16,false> ObjectIntersector16;
@@ -0,0 +1,140 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "../common/ray.h"
+#include "../common/scene_points.h"
+#include "filter.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    template<int M>
+      struct PointIntersectorHitM
+      {
+        __forceinline PointIntersectorHitM() {}
+
+        __forceinline PointIntersectorHitM(const vfloat<M>& t, const Vec3<vfloat<M>>& Ng)
+          : vt(t), vNg(Ng) {}
+        
+        __forceinline void finalize() {}
+        
+        __forceinline Vec2f uv (const size_t i) const { return Vec2f(0.0f,0.0f); }
+        __forceinline float t  (const size_t i) const { return vt[i]; }
+        __forceinline Vec3fa Ng(const size_t i) const { return Vec3fa(vNg.x[i],vNg.y[i],vNg.z[i]); }
+        
+      public:
+        vfloat<M> vt;
+        Vec3<vfloat<M>> vNg;
+      };
+
+    /*! Intersects a ray with M spheres, ray facing discs, or oriented
+     *  discs. The center and radius are passed in p, the disc normal
+     *  and the point subtype in n. Lanes with NaN radius never hit. */
+    template<int M>
+      __forceinline vbool<M> intersectPoints(const Vec3<vfloat<M>>& ray_org, const Vec3<vfloat<M>>& ray_dir, 
+                                             const vfloat<M>& ray_tnear, const vfloat<M>& ray_tfar,
+                                             const Vec4<vfloat<M>>& p, const Vec4<vfloat<M>>& n,
+                                             vfloat<M>& t_o, Vec3<vfloat<M>>& Ng_o)
+    {
+      const Vec3<vfloat<M>> c = p.xyz()-ray_org;
+      const vfloat<M> r2 = p.w*p.w;
+      const vfloat<M> A = dot(ray_dir,ray_dir);
+      const vfloat<M> B = dot(c,ray_dir);
+      const vfloat<M> rcpA = rcp(A);
+      const vbool<M> sphere = n.w == vfloat<M>(float(Points::SPHERE));
+      const vbool<M> oriented = n.w == vfloat<M>(float(Points::ORIENTED_DISC));
+      
+      /* spheres, take the far hit if the ray starts inside */
+      const vfloat<M> C = dot(c,c)-r2;
+      const vfloat<M> D = B*B-A*C;
+      const vfloat<M> Q = sqrt(max(D,vfloat<M>(zero)));
+      const vfloat<M> t0 = (B-Q)*rcpA;
+      const vfloat<M> t1 = (B+Q)*rcpA;
+      const vfloat<M> ts = select(t0 > ray_tnear, t0, t1);
+      
+      /* discs, either facing the ray or with the specified normal */
+      const vfloat<M> dn = dot(ray_dir,n.xyz());
+      const vfloat<M> td = select(oriented, dot(c,n.xyz())*rcp(dn), B*rcpA);
+      const Vec3<vfloat<M>> h = td*ray_dir-c;
+      const vbool<M> valid_disc = (dot(h,h) <= r2) & ((n.w != vfloat<M>(float(Points::ORIENTED_DISC))) | (dn != vfloat<M>(zero)));
+      
+      const vfloat<M> t = select(sphere, ts, td);
+      vbool<M> valid = select(sphere, D >= vfloat<M>(zero), valid_disc);
+      valid &= (ray_tnear < t) & (t < ray_tfar);
+      if (unlikely(none(valid))) return valid;
+
+      /* spheres return the surface normal, discs the plane normal */
+      const Vec3<vfloat<M>> Ns = t*ray_dir-c;
+      const Vec3<vfloat<M>> Nd = select(oriented, n.xyz(), -ray_dir);
+      t_o = t;
+      Ng_o = select(sphere, Ns, Nd);
+      return valid;
+    }
+    
+    template<int M>
+      struct PointIntersector1
+      {
+        struct Precalculations
+        {
+          __forceinline Precalculations() {}
+          __forceinline Precalculations(const Ray& ray, const void* ptr) {}
+        };
+        
+        template<typename Epilog>
+        static __forceinline bool intersect(Ray& ray, const Precalculations& pre,
+                                            const Vec4<vfloat<M>>& p, const Vec4<vfloat<M>>& n,
+                                            const Epilog& epilog)
+        {
+          vfloat<M> t; Vec3<vfloat<M>> Ng;
+          const vbool<M> valid = intersectPoints<M>(Vec3<vfloat<M>>(ray.org),Vec3<vfloat<M>>(ray.dir),
+                                                               vfloat<M>(ray.tnear),vfloat<M>(ray.tfar),p,n,t,Ng);
+          if (unlikely(none(valid))) return false;
+          
+          /* update hit information */
+          PointIntersectorHitM<M> hit(t,Ng);
+          return epilog(valid,hit);
+        }
+      };
+    
+    template<int M, int K>
+      struct PointIntersectorK
+      {
+        struct Precalculations 
+        {
+          __forceinline Precalculations (const vbool<K>& valid, const RayK<K>& ray) {}
+        };
+        
+        template<typename Epilog>
+        static __forceinline bool intersect(RayK<K>& ray, size_t k, const Precalculations& pre,
+                                            const Vec4<vfloat<M>>& p, const Vec4<vfloat<M>>& n,
+                                            const Epilog& epilog)
+        {
+          const Vec3<vfloat<M>> ray_org(ray.org.x[k],ray.org.y[k],ray.org.z[k]);
+          const Vec3<vfloat<M>> ray_dir(ray.dir.x[k],ray.dir.y[k],ray.dir.z[k]);
+          vfloat<M> t; Vec3<vfloat<M>> Ng;
+          const vbool<M> valid = intersectPoints<M>(ray_org,ray_dir,vfloat<M>(ray.tnear[k]),vfloat<M>(ray.tfar[k]),p,n,t,Ng);
+          if (unlikely(none(valid))) return false;
+          
+          /* update hit information */
+          PointIntersectorHitM<M> hit(t,Ng);
+          return epilog(valid,hit);
+        }
+      };
+  }
+}
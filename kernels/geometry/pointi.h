@@ -0,0 +1,250 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "primitive.h"
+
+namespace embree
+{
+  template <int M>
+  struct PointMi
+  {
+    /* Virtual interface to query information about the point type */
+    struct Type : public PrimitiveType
+    {
+      Type();
+      size_t size(const char* This) const;
+    };
+    static Type type;
+
+  public:
+
+    /* Returns maximal number of stored points */
+    static __forceinline size_t max_size() { return M; }
+
+    /* Returns required number of primitive blocks for N points */
+    static __forceinline size_t blocks(size_t N) { return (N+max_size()-1)/max_size(); }
+
+  public:
+
+    /* Default constructor */
+    __forceinline PointMi() {  }
+
+    /* Construction from IDs */
+    __forceinline PointMi(const vint<M>& geomIDs, const vint<M>& primIDs)
+      : geomIDs(geomIDs), primIDs(primIDs) {}
+
+    /* Returns a mask that tells which points are valid */
+    __forceinline vbool<M> valid() const { return primIDs != vint<M>(-1); }
+
+    /* Returns if the specified point is valid */
+    __forceinline bool valid(const size_t i) const { assert(i<M); return primIDs[i] != -1; }
+
+    /* Returns the number of stored points */
+    __forceinline size_t size() const { return __bsf(~movemask(valid())); }
+
+    /* Returns the geometry IDs */
+    __forceinline vint<M> geomID() const { return geomIDs; }
+    __forceinline int geomID(const size_t i) const { assert(i<M); return geomIDs[i]; }
+
+    /* Returns the primitive IDs */
+    __forceinline vint<M> primID() const { return primIDs; }
+    __forceinline int primID(const size_t i) const { assert(i<M); return primIDs[i]; }
+
+    /* gathers center and radius into p, and normal and subtype into n */
+    __forceinline void gather(Vec4<vfloat<M>>& p,
+                              Vec4<vfloat<M>>& n,
+                              const Scene* scene) const;
+
+    __forceinline void gather(Vec4<vfloat<M>>& p,
+                              Vec4<vfloat<M>>& n,
+                              const Points* geom0,
+                              const Points* geom1,
+                              const Points* geom2,
+                              const Points* geom3,
+                              const vint<M>& itime) const;
+
+    __forceinline void gather(Vec4<vfloat<M>>& p,
+                              Vec4<vfloat<M>>& n,
+                              const Scene* scene,
+                              float time) const;
+
+    /* Calculate the bounds of the points */
+    __forceinline const BBox3fa bounds(const Scene* scene, size_t itime = 0) const
+    {
+      BBox3fa bounds = empty;
+      for (size_t i=0; i<M && valid(i); i++)
+      {
+        const Points* geom = scene->get<Points>(geomID(i));
+        bounds.extend(geom->bounds(primID(i),itime));
+      }
+      return bounds;
+    }
+
+    /* Calculate the linear bounds of the primitive */
+    __forceinline LBBox3fa linearBounds(const Scene* scene, size_t itime) {
+      return LBBox3fa(bounds(scene,itime+0), bounds(scene,itime+1));
+    }
+
+    __forceinline LBBox3fa linearBounds(const Scene *const scene, size_t itime, size_t numTimeSteps) {
+      LBBox3fa allBounds = empty;
+      for (size_t i=0; i<M && valid(i); i++)
+      {
+        const Points* geom = scene->get<Points>(geomID(i));
+        allBounds.extend(geom->linearBounds(primID(i), itime, numTimeSteps));
+      }
+      return allBounds;
+    }
+
+    /* Fill points from point list */
+    __forceinline void fill(const PrimRef* prims, size_t& begin, size_t end, Scene* scene)
+    {
+      vint<M> geomID, primID;
+      const PrimRef* prim = &prims[begin];
+
+      for (size_t i=0; i<M; i++)
+      {
+        if (begin<end) {
+          geomID[i] = prim->geomID();
+          primID[i] = prim->primID();
+          begin++;
+        } else {
+          assert(i);
+          if (i>0) {
+            geomID[i] = geomID[i-1];
+            primID[i] = -1;
+          }
+        }
+        if (begin<end) prim = &prims[begin];
+      }
+
+      new (this) PointMi(geomID,primID); // FIXME: use non temporal store
+    }
+
+    /* Fill points from point list */
+    __forceinline LBBox3fa fillMB(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, size_t itime, size_t numTimeSteps)
+    {
+      fill(prims,begin,end,scene);
+      return linearBounds(scene,itime,numTimeSteps);
+    }
+
+    /*! output operator */
+    friend __forceinline std::ostream& operator<<(std::ostream& cout, const PointMi& point) {
+      return cout << "Point" << M << "i {" << point.geomIDs << ", " << point.primIDs << "}";
+    }
+    
+  public:
+    vint<M> geomIDs; // geometry ID
+    vint<M> primIDs; // primitive ID, which is also the index of the point
+  };
+
+  namespace detail
+  {
+    /* loads the normal of the i'th point and stores the subtype in its w component */
+    __forceinline vfloat4 loadPointNormal(const Points* geom, int primID, size_t itime)
+    {
+      const vfloat4 subtype((float)geom->subtype);
+      if (geom->subtype != Points::ORIENTED_DISC) return select<0x7>(vfloat4(zero),subtype);
+      return select<0x7>(vfloat4::loadu(geom->normalPtr(primID,itime)),subtype);
+    }
+  }
+
+  template<>
+    __forceinline void PointMi<4>::gather(Vec4vf4& p,
+                                          Vec4vf4& n,
+                                          const Scene* scene) const
+  {
+    const Points* geom0 = scene->get<Points>(geomIDs[0]);
+    const Points* geom1 = scene->get<Points>(geomIDs[1]);
+    const Points* geom2 = scene->get<Points>(geomIDs[2]);
+    const Points* geom3 = scene->get<Points>(geomIDs[3]);
+
+    /* unused slots have primID -1 and fall back to the first point */
+    const vint4 ids = max(primIDs,vint4(zero));
+
+    const vfloat4 a0 = vfloat4::loadu(geom0->vertexPtr(ids[0]));
+    const vfloat4 a1 = vfloat4::loadu(geom1->vertexPtr(ids[1]));
+    const vfloat4 a2 = vfloat4::loadu(geom2->vertexPtr(ids[2]));
+    const vfloat4 a3 = vfloat4::loadu(geom3->vertexPtr(ids[3]));
+
+    transpose(a0,a1,a2,a3,p.x,p.y,p.z,p.w);
+    p.w = select(valid(),p.w,vfloat4(nan));
+
+    const vfloat4 b0 = detail::loadPointNormal(geom0,ids[0],0);
+    const vfloat4 b1 = detail::loadPointNormal(geom1,ids[1],0);
+    const vfloat4 b2 = detail::loadPointNormal(geom2,ids[2],0);
+    const vfloat4 b3 = detail::loadPointNormal(geom3,ids[3],0);
+
+    transpose(b0,b1,b2,b3,n.x,n.y,n.z,n.w);
+  }
+
+  template<>
+  __forceinline void PointMi<4>::gather(Vec4vf4& p,
+                                        Vec4vf4& n,
+                                        const Points* geom0,
+                                        const Points* geom1,
+                                        const Points* geom2,
+                                        const Points* geom3,
+                                        const vint4& itime) const
+  {
+    /* unused slots have primID -1 and fall back to the first point */
+    const vint4 ids = max(primIDs,vint4(zero));
+
+    const vfloat4 a0 = vfloat4::loadu(geom0->vertexPtr(ids[0],itime[0]));
+    const vfloat4 a1 = vfloat4::loadu(geom1->vertexPtr(ids[1],itime[1]));
+    const vfloat4 a2 = vfloat4::loadu(geom2->vertexPtr(ids[2],itime[2]));
+    const vfloat4 a3 = vfloat4::loadu(geom3->vertexPtr(ids[3],itime[3]));
+
+    transpose(a0,a1,a2,a3,p.x,p.y,p.z,p.w);
+    p.w = select(valid(),p.w,vfloat4(nan));
+
+    const vfloat4 b0 = detail::loadPointNormal(geom0,ids[0],itime[0]);
+    const vfloat4 b1 = detail::loadPointNormal(geom1,ids[1],itime[1]);
+    const vfloat4 b2 = detail::loadPointNormal(geom2,ids[2],itime[2]);
+    const vfloat4 b3 = detail::loadPointNormal(geom3,ids[3],itime[3]);
+
+    transpose(b0,b1,b2,b3,n.x,n.y,n.z,n.w);
+  }
+
+  template<>
+    __forceinline void PointMi<4>::gather(Vec4vf4& p,
+                                          Vec4vf4& n,
+                                          const Scene* scene,
+                                          float time) const
+  {
+    const Points* geom0 = scene->get<Points>(geomIDs[0]);
+    const Points* geom1 = scene->get<Points>(geomIDs[1]);
+    const Points* geom2 = scene->get<Points>(geomIDs[2]);
+    const Points* geom3 = scene->get<Points>(geomIDs[3]);
+
+    const vfloat4 numTimeSegments(geom0->fnumTimeSegments, geom1->fnumTimeSegments, geom2->fnumTimeSegments, geom3->fnumTimeSegments);
+    vfloat4 ftime;
+    const vint4 itime = getTimeSegment(vfloat4(time), numTimeSegments, ftime);
+
+    Vec4vf4 a0,a1;
+    gather(a0,a1,geom0,geom1,geom2,geom3,itime);
+    Vec4vf4 b0,b1;
+    gather(b0,b1,geom0,geom1,geom2,geom3,itime+1);
+    p = lerp(a0,b0,ftime);
+    n = Vec4vf4(lerp(a1.xyz(),b1.xyz(),ftime),a1.w);
+  }
+
+  template<int M>
+  typename PointMi<M>::Type PointMi<M>::type;
+
+  typedef PointMi<4> Point4i;
+}
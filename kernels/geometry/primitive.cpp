@@ -17,7 +17,10 @@
 #include "primitive.h"
 #include "bezier1v.h"
 #include "bezier1i.h"
+#include "bezier1s.h"
+#include "bezier8q.h"
 #include "linei.h"
+#include "pointi.h"
 #include "triangle.h"
 #include "trianglev.h"
 #include "trianglei.h"
@@ -53,6 +56,28 @@ namespace embree
 
   Bezier1i::Type Bezier1i::type;
 
+  /********************** Bezier1s **************************/
+
+  Bezier1s::Type::Type () 
+    : PrimitiveType("bezier1s",sizeof(Bezier1s),1) {} 
+  
+  size_t Bezier1s::Type::size(const char* This) const {
+    return 1;
+  }
+
+  Bezier1s::Type Bezier1s::type;
+
+  /********************** Bezier8q **************************/
+
+  Bezier8q::Type::Type () 
+    : PrimitiveType("bezier8q",sizeof(Bezier8q),Bezier8q::M) {} 
+  
+  size_t Bezier8q::Type::size(const char* This) const {
+    return ((Bezier8q*)This)->size();
+  }
+
+  Bezier8q::Type Bezier8q::type;
+
   /********************** Line4i **************************/
 
   template<>
@@ -64,6 +89,17 @@ namespace embree
     return ((Line4i*)This)->size();
   }
   
+  /********************** Point4i **************************/
+
+  template<>
+  Point4i::Type::Type ()
+    : PrimitiveType("point4i",sizeof(Point4i),4) {}
+
+  template<>
+  size_t Point4i::Type::size(const char* This) const {
+    return ((Point4i*)This)->size();
+  }
+  
   /********************** Triangle4 **************************/
 
   template<>
@@ -0,0 +1,366 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "quad_intersector_moeller.h"
+#include "triangle_intersector_woop.h"
+
+/*! Watertight ray/quad intersector. The quad gets split into the
+ *  triangles (v0,v1,v3) and (v2,v3,v1) which get intersected using
+ *  the watertight test of triangle_intersector_woop.h, thus the
+ *  diagonal and the edges shared with neighboring quads are closed. */
+
+namespace embree
+{
+  namespace isa
+  {
+    struct WoopIntersectorTriangle1
+    {
+      template<int M, typename Epilog>
+        static __forceinline bool intersect(const Vec3<vfloat<M>>& org, const float tnear, const float tfar, const WoopShear1& shear,
+                                            const Vec3<vfloat<M>>& tri_v0,
+                                            const Vec3<vfloat<M>>& tri_v1,
+                                            const Vec3<vfloat<M>>& tri_v2,
+                                            const vbool<M>& flags,
+                                            const Epilog& epilog)
+      {
+        vfloat<M> U,V,W,T,den;
+        const vbool<M> valid = shear.intersect(org,tnear,tfar,tri_v0,tri_v1,tri_v2,U,V,W,T,den);
+        if (unlikely(none(valid))) return false;
+
+        /* update hit information */
+        const Vec3<vfloat<M>> Ng = stable_triangle_normal(tri_v1-tri_v2,tri_v0-tri_v1,tri_v2-tri_v0);
+        QuadHitM<M> hit(valid,V,W,T,den,Ng,flags);
+        return epilog(valid,hit);
+      }
+
+      template<int M, typename Epilog>
+        static __forceinline bool intersect(Ray& ray, const WoopShear1& shear,
+                                            const Vec3<vfloat<M>>& tri_v0,
+                                            const Vec3<vfloat<M>>& tri_v1,
+                                            const Vec3<vfloat<M>>& tri_v2,
+                                            const vbool<M>& flags,
+                                            const Epilog& epilog)
+      {
+        return intersect(Vec3<vfloat<M>>(ray.org),ray.tnear,ray.tfar,shear,tri_v0,tri_v1,tri_v2,flags,epilog);
+      }
+
+      /*! Intersect k'th ray from ray packet of size K with M triangles. */
+      template<int M, int K, typename Epilog>
+        static __forceinline bool intersect1(RayK<K>& ray, size_t k, const WoopShear1& shear,
+                                             const Vec3<vfloat<M>>& tri_v0,
+                                             const Vec3<vfloat<M>>& tri_v1,
+                                             const Vec3<vfloat<M>>& tri_v2,
+                                             const vbool<M>& flags,
+                                             const Epilog& epilog)
+      {
+        return intersect(broadcast<vfloat<M>>(ray.org,k),ray.tnear[k],ray.tfar[k],shear,tri_v0,tri_v1,tri_v2,flags,epilog);
+      }
+    };
+
+    /*! Intersects M quads with 1 ray */
+    template<int M, bool filter>
+      struct QuadMIntersector1Woop
+    {
+      __forceinline QuadMIntersector1Woop() {}
+
+      __forceinline QuadMIntersector1Woop(const Ray& ray, const void* ptr)
+        : shear(ray.dir) {}
+
+      __forceinline void intersect(Ray& ray, IntersectContext* context,
+                                   const Vec3<vfloat<M>>& v0, const Vec3<vfloat<M>>& v1, const Vec3<vfloat<M>>& v2, const Vec3<vfloat<M>>& v3,
+                                   const vint<M>& geomID, const vint<M>& primID) const
+      {
+        Intersect1EpilogM<M,M,filter> epilog(ray,context,geomID,primID);
+        WoopIntersectorTriangle1::intersect(ray,shear,v0,v1,v3,vbool<M>(false),epilog);
+        WoopIntersectorTriangle1::intersect(ray,shear,v2,v3,v1,vbool<M>(true),epilog);
+      }
+
+      __forceinline bool occluded(Ray& ray, IntersectContext* context,
+                                  const Vec3<vfloat<M>>& v0, const Vec3<vfloat<M>>& v1, const Vec3<vfloat<M>>& v2, const Vec3<vfloat<M>>& v3,
+                                  const vint<M>& geomID, const vint<M>& primID) const
+      {
+        Occluded1EpilogM<M,M,filter> epilog(ray,context,geomID,primID);
+        if (WoopIntersectorTriangle1::intersect(ray,shear,v0,v1,v3,vbool<M>(false),epilog)) return true;
+        if (WoopIntersectorTriangle1::intersect(ray,shear,v2,v3,v1,vbool<M>(true ),epilog)) return true;
+        return false;
+      }
+
+    private:
+      WoopShear1 shear;
+    };
+
+#if defined(__AVX512F__)
+
+    /*! Intersects 4 quads with 1 ray using AVX512 */
+    template<bool filter>
+      struct QuadMIntersector1Woop<4,filter>
+    {
+      __forceinline QuadMIntersector1Woop() {}
+
+      __forceinline QuadMIntersector1Woop(const Ray& ray, const void* ptr)
+        : shear(ray.dir) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect(Ray& ray, const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3, const Epilog& epilog) const
+      {
+        const Vec3vf16 vtx0(select(0x0f0f,vfloat16(v0.x),vfloat16(v2.x)),
+                            select(0x0f0f,vfloat16(v0.y),vfloat16(v2.y)),
+                            select(0x0f0f,vfloat16(v0.z),vfloat16(v2.z)));
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf16 vtx1(vfloat16(v1.x),vfloat16(v1.y),vfloat16(v1.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x),vfloat16(v3.y),vfloat16(v3.z));
+#else
+        const Vec3vf16 vtx1(select(0x0f0f,vfloat16(v1.x),vfloat16(v3.x)),
+                            select(0x0f0f,vfloat16(v1.y),vfloat16(v3.y)),
+                            select(0x0f0f,vfloat16(v1.z),vfloat16(v3.z)));
+        const Vec3vf16 vtx2(select(0x0f0f,vfloat16(v3.x),vfloat16(v1.x)),
+                            select(0x0f0f,vfloat16(v3.y),vfloat16(v1.y)),
+                            select(0x0f0f,vfloat16(v3.z),vfloat16(v1.z)));
+#endif
+        const vbool16 flags(0xf0f0);
+        return WoopIntersectorTriangle1::intersect(ray,shear,vtx0,vtx1,vtx2,flags,epilog);
+      }
+
+      __forceinline bool intersect(Ray& ray, IntersectContext* context,
+                                   const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                   const vint4& geomID, const vint4& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Intersect1EpilogM<8,16,filter>(ray,context,vint8(geomID),vint8(primID)));
+      }
+
+      __forceinline bool occluded(Ray& ray, IntersectContext* context,
+                                  const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                  const vint4& geomID, const vint4& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Occluded1EpilogM<8,16,filter>(ray,context,vint8(geomID),vint8(primID)));
+      }
+
+    private:
+      WoopShear1 shear;
+    };
+
+#elif defined (__AVX__)
+
+    /*! Intersects 4 quads with 1 ray using AVX */
+    template<bool filter>
+      struct QuadMIntersector1Woop<4,filter>
+    {
+      __forceinline QuadMIntersector1Woop() {}
+
+      __forceinline QuadMIntersector1Woop(const Ray& ray, const void* ptr)
+        : shear(ray.dir) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect(Ray& ray, const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3, const Epilog& epilog) const
+      {
+        const Vec3vf8 vtx0(vfloat8(v0.x,v2.x),vfloat8(v0.y,v2.y),vfloat8(v0.z,v2.z));
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf8 vtx1(vfloat8(v1.x),vfloat8(v1.y),vfloat8(v1.z));
+        const Vec3vf8 vtx2(vfloat8(v3.x),vfloat8(v3.y),vfloat8(v3.z));
+#else
+        const Vec3vf8 vtx1(vfloat8(v1.x,v3.x),vfloat8(v1.y,v3.y),vfloat8(v1.z,v3.z));
+        const Vec3vf8 vtx2(vfloat8(v3.x,v1.x),vfloat8(v3.y,v1.y),vfloat8(v3.z,v1.z));
+#endif
+        const vbool8 flags(0,0,0,0,1,1,1,1);
+        return WoopIntersectorTriangle1::intersect(ray,shear,vtx0,vtx1,vtx2,flags,epilog);
+      }
+
+      __forceinline bool intersect(Ray& ray, IntersectContext* context, const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                   const vint4& geomID, const vint4& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Intersect1EpilogM<8,8,filter>(ray,context,vint8(geomID),vint8(primID)));
+      }
+
+      __forceinline bool occluded(Ray& ray, IntersectContext* context, const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                  const vint4& geomID, const vint4& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Occluded1EpilogM<8,8,filter>(ray,context,vint8(geomID),vint8(primID)));
+      }
+
+    private:
+      WoopShear1 shear;
+    };
+
+#endif
+
+    /* ----------------------------- */
+    /* -- ray packet intersectors -- */
+    /* ----------------------------- */
+
+    template<int M, int K, bool filter>
+    struct QuadMIntersectorKWoopBase
+    {
+      __forceinline QuadMIntersectorKWoopBase(const vbool<K>& valid, const RayK<K>& ray)
+        : shear(valid,ray) {}
+
+      /*! Intersects K rays with one of M triangles. */
+      template<typename Epilog>
+        __forceinline vbool<K> intersectK(const vbool<K>& valid0,
+                                          RayK<K>& ray,
+                                          const Vec3<vfloat<K>>& tri_v0,
+                                          const Vec3<vfloat<K>>& tri_v1,
+                                          const Vec3<vfloat<K>>& tri_v2,
+                                          const vbool<K>& flags,
+                                          const Epilog& epilog) const
+      {
+        vfloat<K> U,V,W,T,den;
+        const vbool<K> valid = shear.intersect(valid0,ray,tri_v0,tri_v1,tri_v2,U,V,W,T,den);
+        if (unlikely(none(valid))) return false;
+
+        /* calculate hit information */
+        const Vec3<vfloat<K>> Ng = stable_triangle_normal(tri_v1-tri_v2,tri_v0-tri_v1,tri_v2-tri_v0);
+        QuadHitK<K> hit(V,W,T,den,Ng,flags);
+        return epilog(valid,hit);
+      }
+
+      /*! Intersects K rays with one of M quads. */
+      template<typename Epilog>
+      __forceinline bool intersectK(const vbool<K>& valid0,
+                                    RayK<K>& ray,
+                                    const Vec3<vfloat<K>>& v0,
+                                    const Vec3<vfloat<K>>& v1,
+                                    const Vec3<vfloat<K>>& v2,
+                                    const Vec3<vfloat<K>>& v3,
+                                    const Epilog& epilog) const
+      {
+        intersectK(valid0,ray,v0,v1,v3,vbool<K>(false),epilog);
+        if (none(valid0)) return true;
+        intersectK(valid0,ray,v2,v3,v1,vbool<K>(true ),epilog);
+        return none(valid0);
+      }
+
+    protected:
+      WoopShearK<K> shear;
+    };
+
+    template<int M, int K, bool filter>
+      struct QuadMIntersectorKWoop : public QuadMIntersectorKWoopBase<M,K,filter>
+    {
+      __forceinline QuadMIntersectorKWoop(const vbool<K>& valid, const RayK<K>& ray)
+        : QuadMIntersectorKWoopBase<M,K,filter>(valid,ray) {}
+
+      __forceinline void intersect1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                    const Vec3<vfloat<M>>& v0, const Vec3<vfloat<M>>& v1, const Vec3<vfloat<M>>& v2, const Vec3<vfloat<M>>& v3,
+                                    const vint<M>& geomID, const vint<M>& primID) const
+      {
+        Intersect1KEpilogM<M,M,K,filter> epilog(ray,k,context,geomID,primID);
+        const WoopShear1 shear = this->shear.get(k);
+        WoopIntersectorTriangle1::intersect1(ray,k,shear,v0,v1,v3,vbool<M>(false),epilog);
+        WoopIntersectorTriangle1::intersect1(ray,k,shear,v2,v3,v1,vbool<M>(true ),epilog);
+      }
+
+      __forceinline bool occluded1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                   const Vec3<vfloat<M>>& v0, const Vec3<vfloat<M>>& v1, const Vec3<vfloat<M>>& v2, const Vec3<vfloat<M>>& v3,
+                                   const vint<M>& geomID, const vint<M>& primID) const
+      {
+        Occluded1KEpilogM<M,M,K,filter> epilog(ray,k,context,geomID,primID);
+        const WoopShear1 shear = this->shear.get(k);
+        if (WoopIntersectorTriangle1::intersect1(ray,k,shear,v0,v1,v3,vbool<M>(false),epilog)) return true;
+        if (WoopIntersectorTriangle1::intersect1(ray,k,shear,v2,v3,v1,vbool<M>(true ),epilog)) return true;
+        return false;
+      }
+    };
+
+#if defined(__AVX512F__)
+
+    /*! Intersects 4 quads with 1 ray using AVX512 */
+    template<int K, bool filter>
+      struct QuadMIntersectorKWoop<4,K,filter> : public QuadMIntersectorKWoopBase<4,K,filter>
+    {
+      __forceinline QuadMIntersectorKWoop(const vbool<K>& valid, const RayK<K>& ray)
+        : QuadMIntersectorKWoopBase<4,K,filter>(valid,ray) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect1(RayK<K>& ray, size_t k, const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3, const Epilog& epilog) const
+      {
+        const Vec3vf16 vtx0(select(0x0f0f,vfloat16(v0.x),vfloat16(v2.x)),
+                            select(0x0f0f,vfloat16(v0.y),vfloat16(v2.y)),
+                            select(0x0f0f,vfloat16(v0.z),vfloat16(v2.z)));
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf16 vtx1(vfloat16(v1.x),vfloat16(v1.y),vfloat16(v1.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x),vfloat16(v3.y),vfloat16(v3.z));
+#else
+        const Vec3vf16 vtx1(select(0x0f0f,vfloat16(v1.x),vfloat16(v3.x)),
+                            select(0x0f0f,vfloat16(v1.y),vfloat16(v3.y)),
+                            select(0x0f0f,vfloat16(v1.z),vfloat16(v3.z)));
+        const Vec3vf16 vtx2(select(0x0f0f,vfloat16(v3.x),vfloat16(v1.x)),
+                            select(0x0f0f,vfloat16(v3.y),vfloat16(v1.y)),
+                            select(0x0f0f,vfloat16(v3.z),vfloat16(v1.z)));
+#endif
+
+        const vbool16 flags(0xf0f0);
+        return WoopIntersectorTriangle1::intersect1(ray,k,this->shear.get(k),vtx0,vtx1,vtx2,flags,epilog);
+      }
+
+      __forceinline bool intersect1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                    const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                    const vint4& geomID, const vint4& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Intersect1KEpilogM<8,16,K,filter>(ray,k,context,vint8(geomID),vint8(primID)));
+      }
+
+      __forceinline bool occluded1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                   const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                   const vint4& geomID, const vint4& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Occluded1KEpilogM<8,16,K,filter>(ray,k,context,vint8(geomID),vint8(primID)));
+      }
+    };
+
+#elif defined (__AVX__)
+
+    /*! Intersects 4 quads with 1 ray using AVX */
+     template<int K, bool filter>
+       struct QuadMIntersectorKWoop<4,K,filter> : public QuadMIntersectorKWoopBase<4,K,filter>
+    {
+      __forceinline QuadMIntersectorKWoop(const vbool<K>& valid, const RayK<K>& ray)
+        : QuadMIntersectorKWoopBase<4,K,filter>(valid,ray) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect1(RayK<K>& ray, size_t k, const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3, const Epilog& epilog) const
+      {
+        const Vec3vf8 vtx0(vfloat8(v0.x,v2.x),vfloat8(v0.y,v2.y),vfloat8(v0.z,v2.z));
+        const vbool8 flags(0,0,0,0,1,1,1,1);
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf8 vtx1(vfloat8(v1.x),vfloat8(v1.y),vfloat8(v1.z));
+        const Vec3vf8 vtx2(vfloat8(v3.x),vfloat8(v3.y),vfloat8(v3.z));
+#else
+        const Vec3vf8 vtx1(vfloat8(v1.x,v3.x),vfloat8(v1.y,v3.y),vfloat8(v1.z,v3.z));
+        const Vec3vf8 vtx2(vfloat8(v3.x,v1.x),vfloat8(v3.y,v1.y),vfloat8(v3.z,v1.z));
+#endif
+        return WoopIntersectorTriangle1::intersect1(ray,k,this->shear.get(k),vtx0,vtx1,vtx2,flags,epilog);
+      }
+
+      __forceinline bool intersect1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                    const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                    const vint4& geomID, const vint4& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Intersect1KEpilogM<8,8,K,filter>(ray,k,context,vint8(geomID),vint8(primID)));
+      }
+
+      __forceinline bool occluded1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                   const Vec3vf4& v0, const Vec3vf4& v1, const Vec3vf4& v2, const Vec3vf4& v3,
+                                   const vint4& geomID, const vint4& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Occluded1KEpilogM<8,8,K,filter>(ray,k,context,vint8(geomID),vint8(primID)));
+      }
+    };
+
+#endif
+  }
+}
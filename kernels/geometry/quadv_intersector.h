@@ -19,6 +19,7 @@
 #include "quadv.h"
 #include "quad_intersector_moeller.h"
 #include "quad_intersector_pluecker.h"
+#include "quad_intersector_woop.h"
 
 namespace embree
 {
@@ -119,10 +120,10 @@ namespace embree
 
     /*! Intersects M quads with 1 ray */
     template<int M, bool filter>
-      struct QuadMvIntersector1Pluecker
+      struct QuadMvIntersector1Woop
     {
       typedef QuadMv<M> Primitive;
-      typedef Intersector1Precalculations<QuadMIntersector1Pluecker<M,filter>> Precalculations;
+      typedef Intersector1Precalculations<QuadMIntersector1Woop<M,filter>> Precalculations;
         
       /*! Intersect a ray with the M quads and updates the hit. */
       static __forceinline void intersect(const Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& quad)
@@ -156,10 +157,10 @@ namespace embree
 
     /*! Intersects M triangles with K rays. */
     template<int M, int K, bool filter>
-      struct QuadMvIntersectorKPluecker
+      struct QuadMvIntersectorKWoop
       {
         typedef QuadMv<M> Primitive;
-        typedef IntersectorKPrecalculations<K,QuadMIntersectorKPluecker<M,K,filter>> Precalculations;
+        typedef IntersectorKPrecalculations<K,QuadMIntersectorKWoop<M,K,filter>> Precalculations;
         
         /*! Intersects K rays with M triangles. */
         static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const QuadMv<M>& quad)
@@ -0,0 +1,337 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "triangle.h"
+#include "trianglev.h"
+#include "intersector_epilog.h"
+
+/*! Watertight ray/triangle intersector of Woop, Benthin and Wald. The
+ *  triangle vertices get translated into the ray origin, permuted such
+ *  that the largest component of the ray direction becomes the z axis,
+ *  and sheared such that the ray points along z. The edge tests are
+ *  then 2D tests in the xy plane. As the transformed vertices only
+ *  depend on the ray and the vertex itself, neighboring triangles
+ *  evaluate bitwise identical edge functions for a shared edge, thus
+ *  no ray can slip through between triangles. */
+
+namespace embree
+{
+  namespace isa
+  {
+    /*! Per ray constants of the watertight test. */
+    struct WoopShear1
+    {
+      __forceinline WoopShear1() {}
+
+      __forceinline WoopShear1(const Vec3fa& dir)
+      {
+        /* the largest dimension of the ray direction becomes z, swapping x and y keeps the winding */
+        kz = maxDim(abs(dir));
+        kx = kz == 2 ? 0 : kz+1;
+        ky = kx == 2 ? 0 : kx+1;
+        if (dir[kz] < 0.0f) std::swap(kx,ky);
+
+        /* shear constants that map the ray direction onto the z axis */
+        Sz = 1.0f/dir[kz];
+        Sx = dir[kx]*Sz;
+        Sy = dir[ky]*Sz;
+      }
+
+      /*! Calculates the unnormalized barycentric coordinates U,V,W,
+       *  the denominator and the scaled hit distance of M triangles,
+       *  returns the mask of the hit triangles. */
+      template<int M>
+      __forceinline vbool<M> intersect(const Vec3<vfloat<M>>& O, const float tnear, const float tfar,
+                                       const Vec3<vfloat<M>>& tri_v0, const Vec3<vfloat<M>>& tri_v1, const Vec3<vfloat<M>>& tri_v2,
+                                       vfloat<M>& U, vfloat<M>& V, vfloat<M>& W, vfloat<M>& T, vfloat<M>& den) const
+      {
+        /* calculate vertices relative to ray origin */
+        typedef Vec3<vfloat<M>> Vec3vfM;
+        const Vec3vfM A = tri_v0-O;
+        const Vec3vfM B = tri_v1-O;
+        const Vec3vfM C = tri_v2-O;
+
+        /* shear and scale vertices */
+        const vfloat<M> sx(Sx), sy(Sy);
+        const vfloat<M> Ax = A[kx]-sx*A[kz], Ay = A[ky]-sy*A[kz];
+        const vfloat<M> Bx = B[kx]-sx*B[kz], By = B[ky]-sy*B[kz];
+        const vfloat<M> Cx = C[kx]-sx*C[kz], Cy = C[ky]-sy*C[kz];
+
+        /* perform edge tests */
+        U = Cx*By-Cy*Bx;
+        V = Ax*Cy-Ay*Cx;
+        W = Bx*Ay-By*Ax;
+#if defined(EMBREE_BACKFACE_CULLING)
+        vbool<M> valid = max(U,V,W) <= 0.0f;
+#else
+        vbool<M> valid = (min(U,V,W) >= 0.0f) | (max(U,V,W) <= 0.0f);
+#endif
+        if (unlikely(none(valid))) return false;
+
+        /* avoid division by 0 */
+        den = U+V+W;
+        valid &= den != vfloat<M>(zero);
+        if (unlikely(none(valid))) return false;
+
+        /* perform depth test */
+        const vfloat<M> sz(Sz);
+        T = U*(sz*A[kz]) + V*(sz*B[kz]) + W*(sz*C[kz]);
+        const vfloat<M> absDen = abs(den);
+        const vfloat<M> sgnDen = signmsk(den);
+        valid &= ((T^sgnDen) >= absDen*vfloat<M>(tnear));
+        valid &= (absDen*vfloat<M>(tfar) >= (T^sgnDen));
+        return valid;
+      }
+
+    public:
+      int kx,ky,kz;       //!< permutation of the dimensions
+      float Sx,Sy,Sz;     //!< shear constants
+    };
+
+    /*! Per ray constants of the watertight test for a packet of K rays. */
+    template<int K>
+      struct WoopShearK
+    {
+      __forceinline WoopShearK() {}
+
+      __forceinline WoopShearK(const vbool<K>& valid, const RayK<K>& ray)
+      {
+        const Vec3<vfloat<K>> absDir = abs(ray.dir);
+        kz = select(absDir.x >= max(absDir.y,absDir.z),vint<K>(0),select(absDir.y >= absDir.z,vint<K>(1),vint<K>(2)));
+        kx = select(kz == vint<K>(2),vint<K>(0),kz+1);
+        ky = select(kx == vint<K>(2),vint<K>(0),kx+1);
+        const vfloat<K> dirz = permute(ray.dir,kz);
+        const vbool<K> swap = dirz < 0.0f;
+        const vint<K> kx0 = kx;
+        kx = select(swap,ky,kx);
+        ky = select(swap,kx0,ky);
+
+        Sz = select(valid,vfloat<K>(one)/dirz,vfloat<K>(zero));
+        Sx = permute(ray.dir,kx)*Sz;
+        Sy = permute(ray.dir,ky)*Sz;
+      }
+
+      /*! returns the constants of the k'th ray */
+      __forceinline WoopShear1 get(size_t k) const
+      {
+        WoopShear1 shear;
+        shear.kx = kx[k]; shear.ky = ky[k]; shear.kz = kz[k];
+        shear.Sx = Sx[k]; shear.Sy = Sy[k]; shear.Sz = Sz[k];
+        return shear;
+      }
+
+      /*! selects the component of each ray */
+      static __forceinline vfloat<K> permute(const Vec3<vfloat<K>>& v, const vint<K>& k) {
+        return select(k == vint<K>(0),v.x,select(k == vint<K>(1),v.y,v.z));
+      }
+
+      /*! Calculates the unnormalized barycentric coordinates U,V,W,
+       *  the denominator and the scaled hit distance of K rays with
+       *  one triangle, returns the mask of the hitting rays. */
+      __forceinline vbool<K> intersect(const vbool<K>& valid0, const RayK<K>& ray,
+                                       const Vec3<vfloat<K>>& tri_v0, const Vec3<vfloat<K>>& tri_v1, const Vec3<vfloat<K>>& tri_v2,
+                                       vfloat<K>& U, vfloat<K>& V, vfloat<K>& W, vfloat<K>& T, vfloat<K>& den) const
+      {
+        /* calculate vertices relative to ray origin */
+        typedef Vec3<vfloat<K>> Vec3vfK;
+        const Vec3vfK A = tri_v0-ray.org;
+        const Vec3vfK B = tri_v1-ray.org;
+        const Vec3vfK C = tri_v2-ray.org;
+
+        /* shear and scale vertices, the same operations as for a single ray */
+        const vfloat<K> Az = permute(A,kz), Bz = permute(B,kz), Cz = permute(C,kz);
+        const vfloat<K> Ax = permute(A,kx)-Sx*Az, Ay = permute(A,ky)-Sy*Az;
+        const vfloat<K> Bx = permute(B,kx)-Sx*Bz, By = permute(B,ky)-Sy*Bz;
+        const vfloat<K> Cx = permute(C,kx)-Sx*Cz, Cy = permute(C,ky)-Sy*Cz;
+
+        /* perform edge tests */
+        U = Cx*By-Cy*Bx;
+        V = Ax*Cy-Ay*Cx;
+        W = Bx*Ay-By*Ax;
+        vbool<K> valid = valid0;
+#if defined(EMBREE_BACKFACE_CULLING)
+        valid &= max(U,V,W) <= 0.0f;
+#else
+        valid &= (min(U,V,W) >= 0.0f) | (max(U,V,W) <= 0.0f);
+#endif
+        if (unlikely(none(valid))) return false;
+
+        /* avoid division by 0 */
+        den = U+V+W;
+        valid &= den != vfloat<K>(zero);
+        if (unlikely(none(valid))) return false;
+
+        /* perform depth test */
+        T = U*(Sz*Az) + V*(Sz*Bz) + W*(Sz*Cz);
+        const vfloat<K> absDen = abs(den);
+        const vfloat<K> sgnDen = signmsk(den);
+        valid &= ((T^sgnDen) >= absDen*ray.tnear);
+        valid &= (absDen*ray.tfar >= (T^sgnDen));
+        return valid;
+      }
+
+    public:
+      vint<K> kx,ky,kz;   //!< permutation of the dimensions
+      vfloat<K> Sx,Sy,Sz; //!< shear constants
+    };
+
+    /*! The geometry normal gets only calculated for reported hits. */
+    template<int M, typename UVMapper>
+      struct WoopHitM
+    {
+      __forceinline WoopHitM(const vfloat<M>& V, const vfloat<M>& W, const vfloat<M>& T, const vfloat<M>& den,
+                             const Vec3<vfloat<M>>& v0, const Vec3<vfloat<M>>& v1, const Vec3<vfloat<M>>& v2, const UVMapper& mapUV)
+        : V(V), W(W), T(T), den(den), v0(v0), v1(v1), v2(v2), mapUV(mapUV) {}
+
+      __forceinline void finalize()
+      {
+        const vfloat<M> rcpDen = rcp(den);
+        vt = T * rcpDen;
+        vu = V * rcpDen;
+        vv = W * rcpDen;
+        mapUV(vu,vv);
+        vNg = stable_triangle_normal(v1-v2,v0-v1,v2-v0);
+      }
+
+      __forceinline Vec2f uv (const size_t i) const { return Vec2f(vu[i],vv[i]); }
+      __forceinline float t  (const size_t i) const { return vt[i]; }
+      __forceinline Vec3fa Ng(const size_t i) const { return Vec3fa(vNg.x[i],vNg.y[i],vNg.z[i]); }
+
+    private:
+      const vfloat<M> V;
+      const vfloat<M> W;
+      const vfloat<M> T;
+      const vfloat<M> den;
+      const Vec3<vfloat<M>> v0;
+      const Vec3<vfloat<M>> v1;
+      const Vec3<vfloat<M>> v2;
+      const UVMapper& mapUV;
+
+    public:
+      vfloat<M> vu;
+      vfloat<M> vv;
+      vfloat<M> vt;
+      Vec3<vfloat<M>> vNg;
+    };
+
+    template<int K, typename UVMapper>
+      struct WoopHitK
+    {
+      __forceinline WoopHitK(const vfloat<K>& V, const vfloat<K>& W, const vfloat<K>& T, const vfloat<K>& den,
+                             const Vec3<vfloat<K>>& v0, const Vec3<vfloat<K>>& v1, const Vec3<vfloat<K>>& v2, const UVMapper& mapUV)
+        : V(V), W(W), T(T), den(den), v0(v0), v1(v1), v2(v2), mapUV(mapUV) {}
+
+      __forceinline std::tuple<vfloat<K>,vfloat<K>,vfloat<K>,Vec3<vfloat<K>>> operator() () const
+      {
+        const vfloat<K> rcpDen = rcp(den);
+        const vfloat<K> t = T * rcpDen;
+        vfloat<K> u = V * rcpDen;
+        vfloat<K> v = W * rcpDen;
+        mapUV(u,v);
+        const Vec3<vfloat<K>> Ng = stable_triangle_normal(v1-v2,v0-v1,v2-v0);
+        return std::make_tuple(u,v,t,Ng);
+      }
+
+    private:
+      const vfloat<K> V;
+      const vfloat<K> W;
+      const vfloat<K> T;
+      const vfloat<K> den;
+      const Vec3<vfloat<K>> v0;
+      const Vec3<vfloat<K>> v1;
+      const Vec3<vfloat<K>> v2;
+      const UVMapper& mapUV;
+    };
+
+    template<int M>
+      struct WoopIntersector1
+      {
+        __forceinline WoopIntersector1() {}
+
+        __forceinline WoopIntersector1(const Ray& ray, const void* ptr)
+          : shear(ray.dir) {}
+
+        template<typename UVMapper, typename Epilog>
+          __forceinline bool intersect(Ray& ray,
+                                       const Vec3<vfloat<M>>& tri_v0,
+                                       const Vec3<vfloat<M>>& tri_v1,
+                                       const Vec3<vfloat<M>>& tri_v2,
+                                       const UVMapper& mapUV,
+                                       const Epilog& epilog) const
+        {
+          vfloat<M> U,V,W,T,den;
+          const vbool<M> valid = shear.intersect(Vec3<vfloat<M>>(ray.org),ray.tnear,ray.tfar,tri_v0,tri_v1,tri_v2,U,V,W,T,den);
+          if (unlikely(none(valid))) return false;
+
+          /* update hit information */
+          WoopHitM<M,UVMapper> hit(V,W,T,den,tri_v0,tri_v1,tri_v2,mapUV);
+          return epilog(valid,hit);
+        }
+
+      private:
+        WoopShear1 shear;
+      };
+
+    template<int M, int K>
+      struct WoopIntersectorK
+      {
+        __forceinline WoopIntersectorK(const vbool<K>& valid, const RayK<K>& ray)
+          : shear(valid,ray) {}
+
+        /*! Intersects K rays with one of M triangles. */
+        template<typename UVMapper, typename Epilog>
+          __forceinline vbool<K> intersectK(const vbool<K>& valid0,
+                                            RayK<K>& ray,
+                                            const Vec3<vfloat<K>>& tri_v0,
+                                            const Vec3<vfloat<K>>& tri_v1,
+                                            const Vec3<vfloat<K>>& tri_v2,
+                                            const UVMapper& mapUV,
+                                            const Epilog& epilog) const
+        {
+          vfloat<K> U,V,W,T,den;
+          const vbool<K> valid = shear.intersect(valid0,ray,tri_v0,tri_v1,tri_v2,U,V,W,T,den);
+          if (unlikely(none(valid))) return false;
+
+          /* calculate hit information */
+          WoopHitK<K,UVMapper> hit(V,W,T,den,tri_v0,tri_v1,tri_v2,mapUV);
+          return epilog(valid,hit);
+        }
+
+        /*! Intersect k'th ray from ray packet of size K with M triangles. */
+        template<typename UVMapper, typename Epilog>
+          __forceinline bool intersect(RayK<K>& ray, size_t k,
+                                       const Vec3<vfloat<M>>& tri_v0,
+                                       const Vec3<vfloat<M>>& tri_v1,
+                                       const Vec3<vfloat<M>>& tri_v2,
+                                       const UVMapper& mapUV,
+                                       const Epilog& epilog) const
+        {
+          vfloat<M> U,V,W,T,den;
+          const vbool<M> valid = shear.get(k).intersect(broadcast<vfloat<M>>(ray.org,k),ray.tnear[k],ray.tfar[k],tri_v0,tri_v1,tri_v2,U,V,W,T,den);
+          if (unlikely(none(valid))) return false;
+
+          /* calculate hit information */
+          WoopHitM<M,UVMapper> hit(V,W,T,den,tri_v0,tri_v1,tri_v2,mapUV);
+          return epilog(valid,hit);
+        }
+
+      private:
+        WoopShearK<K> shear;
+      };
+  }
+}
@@ -19,6 +19,7 @@
 #include "triangle.h"
 #include "triangle_intersector_pluecker.h"
 #include "triangle_intersector_moeller.h"
+#include "triangle_intersector_woop.h"
 
 namespace embree
 {
@@ -116,10 +117,10 @@ namespace embree
 
     /*! Intersects M triangles with 1 ray */
     template<int M, int Mx, bool filter>
-      struct TriangleMvIntersector1Pluecker
+      struct TriangleMvIntersector1Woop
       {
         typedef TriangleMv<M> Primitive;
-        typedef Intersector1Precalculations<PlueckerIntersector1<Mx>> Precalculations;
+        typedef Intersector1Precalculations<WoopIntersector1<Mx>> Precalculations;
         
         /*! Intersect a ray with M triangles and updates the hit. */
         static __forceinline void intersect(Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& tri)
@@ -152,10 +153,10 @@ namespace embree
 
     /*! Intersects M triangles with K rays */
     template<int M, int Mx, int K, bool filter>
-      struct TriangleMvIntersectorKPluecker
+      struct TriangleMvIntersectorKWoop
       {
         typedef TriangleMv<M> Primitive;
-        typedef IntersectorKPrecalculations<K,PlueckerIntersectorK<Mx,K>> Precalculations;
+        typedef IntersectorKPrecalculations<K,WoopIntersectorK<Mx,K>> Precalculations;
         
         /*! Intersects K rays with M triangles. */
         static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& tri)
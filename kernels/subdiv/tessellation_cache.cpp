@@ -45,6 +45,8 @@ namespace embree
     localTime              = NUM_CACHE_SEGMENTS;
     next_block             = 0;
     numRenderThreads       = 0;
+    numFlushes             = 0;
+    numFilledSegments      = 0;
 #if FORCE_SIMPLE_FLUSH == 1
     switch_block_threshold = maxBlocks;
 #else
@@ -122,7 +124,8 @@ namespace embree
         assert( switch_block_threshold <= maxBlocks );
 #endif
         
-        CACHE_STATS(SharedTessellationCacheStats::cache_flushes++);
+        numFlushes++;
+        numFilledSegments = min(numFilledSegments+1,NUM_CACHE_SEGMENTS-1);
         
         /* release all blocked threads */
         
@@ -165,6 +168,7 @@ namespace embree
 
     /* reset local time */
     localTime = NUM_CACHE_SEGMENTS;
+    numFilledSegments = 0;
 
     /* release all blocked threads */
     for (ThreadWorkState *t=current_t_state;t!=nullptr;t=t->next)
@@ -199,6 +203,7 @@ namespace embree
 
     /* invalidate entire cache */
     localTime += NUM_CACHE_SEGMENTS; 
+    numFilledSegments = 0;
 
     /* reset to the first segment */
 #if FORCE_SIMPLE_FLUSH == 1
@@ -222,35 +227,72 @@ namespace embree
     reset_state.unlock();
   }
 
+  size_t SharedLazyTessellationCache::getNumCachedBytes()
+  {
+    Lock<SpinLock> lock(reset_state);
+#if FORCE_SIMPLE_FLUSH == 1
+    return min(next_block.load(),switch_block_threshold.load())*BLOCK_SIZE;
+#else
+    /* all previously filled segments that did not get invalidated yet plus the current segment */
+    const size_t segmentBlocks = maxBlocks/NUM_CACHE_SEGMENTS;
+    const size_t segmentBegin = switch_block_threshold - segmentBlocks;
+    const size_t currentBlocks = min(next_block.load(),switch_block_threshold.load()) - segmentBegin;
+    return (numFilledSegments*segmentBlocks + currentBlocks)*BLOCK_SIZE;
+#endif
+  }
+
+  void SharedLazyTessellationCache::getThreadStats(SharedTessellationCacheStats& stats)
+  {
+    Lock<SpinLock> lock(linkedlist_mtx);
+    for (ThreadWorkState *t=current_t_state;t!=nullptr;t=t->next) {
+      stats.hits       += t->hits.load(std::memory_order_relaxed);
+      stats.misses     += t->misses.load(std::memory_order_relaxed);
+      stats.contention += t->contention.load(std::memory_order_relaxed);
+    }
+  }
+
+  void SharedLazyTessellationCache::clearThreadStats()
+  {
+    Lock<SpinLock> lock(linkedlist_mtx);
+    for (ThreadWorkState *t=current_t_state;t!=nullptr;t=t->next) {
+      t->hits.store(0,std::memory_order_relaxed);
+      t->misses.store(0,std::memory_order_relaxed);
+      t->contention.store(0,std::memory_order_relaxed);
+    }
+    numFlushes = 0;
+  }
 
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-  std::atomic<size_t> SharedTessellationCacheStats::cache_accesses(0);
-  std::atomic<size_t> SharedTessellationCacheStats::cache_hits(0);
-  std::atomic<size_t> SharedTessellationCacheStats::cache_misses(0);
-  std::atomic<size_t> SharedTessellationCacheStats::cache_flushes(0);  
-  SpinLock   SharedTessellationCacheStats::mtx;  
-  size_t SharedTessellationCacheStats::cache_num_patches(0);
+  SharedTessellationCacheStats SharedTessellationCacheStats::getStats()
+  {
+    SharedTessellationCacheStats stats;
+    SharedLazyTessellationCache::sharedLazyTessellationCache.getThreadStats(stats);
+    stats.flushes    = SharedLazyTessellationCache::sharedLazyTessellationCache.getNumFlushes();
+    stats.accesses   = stats.hits + stats.misses;
+    stats.usedBytes  = SharedLazyTessellationCache::sharedLazyTessellationCache.getNumCachedBytes();
+    stats.totalBytes = SharedLazyTessellationCache::sharedLazyTessellationCache.getSize();
+    return stats;
+  }
 
   void SharedTessellationCacheStats::printStats()
   {
-    PRINT(cache_accesses);
-    PRINT(cache_misses);
-    PRINT(cache_hits);
-    PRINT(cache_flushes);
-    PRINT(100.0f * cache_hits / cache_accesses);
-    assert(cache_hits + cache_misses == cache_accesses);
-    PRINT(cache_num_patches);
+    SharedTessellationCacheStats stats = getStats();
+    PRINT(stats.accesses);
+    PRINT(stats.misses);
+    PRINT(stats.hits);
+    PRINT(stats.flushes);
+    PRINT(stats.contention);
+    PRINT(100.0f * stats.hits / stats.accesses);
+    PRINT(stats.usedBytes);
+    PRINT(stats.totalBytes);
   }
 
   void SharedTessellationCacheStats::clearStats()
   {
-    SharedTessellationCacheStats::cache_accesses  = 0;
-    SharedTessellationCacheStats::cache_hits      = 0;
-    SharedTessellationCacheStats::cache_misses    = 0;
-    SharedTessellationCacheStats::cache_flushes   = 0;
+    SharedLazyTessellationCache::sharedLazyTessellationCache.clearThreadStats();
   }
 
   struct cache_regression_test : public RegressionTest
@@ -34,17 +34,24 @@ namespace embree
   class SharedTessellationCacheStats
   {
   public:
-    /* stats */
-    static std::atomic<size_t> cache_accesses;
-    static std::atomic<size_t> cache_hits;
-    static std::atomic<size_t> cache_misses;
-    static std::atomic<size_t> cache_flushes;                
-    static size_t        cache_num_patches;
-    __aligned(64) static SpinLock mtx;
-    
+    __forceinline SharedTessellationCacheStats ()
+      : accesses(0), hits(0), misses(0), flushes(0), contention(0), usedBytes(0), totalBytes(0) {}
+
+    /*! returns the statistics gathered since the last call to clearStats */
+    static SharedTessellationCacheStats getStats();
+
     /* print stats for debugging */                 
     static void printStats();
     static void clearStats();
+
+  public:
+    size_t accesses;    //!< number of cache lookups
+    size_t hits;        //!< number of lookups that found valid data
+    size_t misses;      //!< number of lookups that had to build the data
+    size_t flushes;     //!< number of cache segment switches
+    size_t contention;  //!< number of times a thread had to wait for other threads
+    size_t usedBytes;   //!< number of bytes currently occupied by cached data
+    size_t totalBytes;  //!< size of the cache in bytes
   };
   
   void resizeTessellationCache(size_t new_size);
@@ -62,11 +69,22 @@ namespace embree
    ThreadWorkState* next;
    bool allocated;
 
+   /* statistics, only incremented by the thread owning this state,
+    * relaxed atomics as other threads read and reset them */
+   std::atomic<size_t> hits;
+   std::atomic<size_t> misses;
+   std::atomic<size_t> contention;
+
    __forceinline ThreadWorkState(bool allocated = false) 
-     : counter(0), next(nullptr), allocated(allocated) 
+     : counter(0), next(nullptr), allocated(allocated), hits(0), misses(0), contention(0)
    {
      assert( ((size_t)this % 64) == 0 ); 
    }   
+
+   /* increments a statistics counter without a locked read-modify-write */
+   static __forceinline void count(std::atomic<size_t>& counter) {
+     counter.store(counter.load(std::memory_order_relaxed)+1,std::memory_order_relaxed);
+   }
  };
 
  class __aligned(64) SharedLazyTessellationCache 
@@ -151,6 +169,8 @@ namespace embree
    __aligned(64) SpinLock   linkedlist_mtx;
    __aligned(64) std::atomic<size_t> switch_block_threshold;
    __aligned(64) std::atomic<size_t> numRenderThreads;
+   __aligned(64) std::atomic<size_t> numFlushes;
+   size_t numFilledSegments;
 
 
  public:
@@ -197,6 +217,7 @@ namespace embree
        if (unlikely(lock >= THREAD_BLOCK_ATOMIC_ADD))
        {
          /* lock failed wait until sync phase is over */
+         ThreadWorkState::count(t_state->contention);
          sharedLazyTessellationCache.unlockThread(t_state,-1);	       
          sharedLazyTessellationCache.waitForUsersLessEqual(t_state,0);
        }
@@ -208,7 +229,6 @@ namespace embree
    static __forceinline void* lookup(CacheEntry& entry, size_t globalTime)
    {   
      const int64_t subdiv_patch_root_ref = entry.tag.get(); 
-     CACHE_STATS(SharedTessellationCacheStats::cache_accesses++);
      
      if (likely(subdiv_patch_root_ref != 0)) 
      {
@@ -216,12 +236,8 @@ namespace embree
        const size_t subdiv_patch_cache_index = extractCommitIndex(subdiv_patch_root_ref);
        
        if (likely( sharedLazyTessellationCache.validCacheIndex(subdiv_patch_cache_index,globalTime) ))
-       {
-         CACHE_STATS(SharedTessellationCacheStats::cache_hits++);
          return (void*) subdiv_patch_root;
-       }
      }
-     CACHE_STATS(SharedTessellationCacheStats::cache_misses++);
      return nullptr;
    }
 
@@ -234,12 +250,16 @@ namespace embree
      {
        sharedLazyTessellationCache.lockThreadLoop(t_state);
        void* patch = SharedLazyTessellationCache::lookup(entry,globalTime);
-       if (patch) return (decltype(constructor())) patch;
+       if (patch) {
+         ThreadWorkState::count(t_state->hits);
+         return (decltype(constructor())) patch;
+       }
        
        if (entry.mutex.try_lock())
        {
          if (!validTag(entry.tag,globalTime)) 
          {
+           ThreadWorkState::count(t_state->misses);
            auto timeBefore = sharedLazyTessellationCache.getTime(globalTime);
            auto ret = constructor(); // thread is locked here!
            assert(ret);
@@ -254,6 +274,7 @@ namespace embree
          }
          entry.mutex.unlock();
        }
+       ThreadWorkState::count(t_state->contention);
        SharedLazyTessellationCache::sharedLazyTessellationCache.unlockThread(t_state);
      }
    }
@@ -324,12 +345,20 @@ namespace embree
 
    __forceinline void*  getDataPtr()      { return data; }
    __forceinline size_t getNumUsedBytes() { return next_block * BLOCK_SIZE; }
+   __forceinline size_t getNumFlushes()   { return numFlushes; }
    __forceinline size_t getMaxBlocks()    { return maxBlocks; }
    __forceinline size_t getSize()         { return size; }
 
    void allocNextSegment();
    void realloc(const size_t newSize);
 
+   /*! returns the number of bytes occupied by valid cache segments */
+   size_t getNumCachedBytes();
+
+   /*! accumulates the statistics of all thread states */
+   void getThreadStats(SharedTessellationCacheStats& stats);
+   void clearThreadStats();
+
    void reset();
 
    static SharedLazyTessellationCache sharedLazyTessellationCache;
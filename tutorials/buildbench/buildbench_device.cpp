@@ -383,6 +383,31 @@ namespace embree {
     std::cout << "done" << std::endl;
   }
 
+  /* measures static build performance with all build threads pinned within one core complex, NUMA node, socket, and all sockets */
+  void Benchmark_Topology(ISPCScene* scene_in, size_t benchmark_iterations, const std::string& cfg)
+  {
+    const CPUTopologyLevel levels[] = { CPU_TOPOLOGY_CACHE, CPU_TOPOLOGY_NODE, CPU_TOPOLOGY_PACKAGE, CPU_TOPOLOGY_REMOTE };
+    const char* names[] = { "core complex", "NUMA node", "socket", "all sockets" };
+
+    size_t lastNumThreads = 0;
+    for (size_t i=0; i<sizeof(levels)/sizeof(levels[0]); i++)
+    {
+      const size_t numThreads = getNumberOfLogicalThreads(levels[i]);
+      if (numThreads == lastNumThreads) continue;
+      lastNumThreads = numThreads;
+
+      const std::string init = cfg + ",threads=" + std::to_string((long long)numThreads);
+      g_device = rtcNewDevice(init.c_str());
+      error_handler(nullptr,rtcDeviceGetError(g_device));
+      rtcDeviceSetErrorFunction2(g_device,error_handler,nullptr);
+
+      std::cout << "Topology " << std::setw(12) << names[i] << " (" << std::setw(3) << numThreads << " threads), ";
+      Benchmark_Static_Create(scene_in,benchmark_iterations,RTC_GEOMETRY_STATIC,RTC_SCENE_STATIC);
+      rtcDeleteDevice(g_device); g_device = nullptr;
+      Pause();
+    }
+  }
+
 
   /* called by the C++ code for initialization */
   extern "C" void device_init (char* cfg)
@@ -416,6 +441,8 @@ namespace embree {
     Benchmark_Static_Create(g_ispc_scene,iterations_static_static,RTC_GEOMETRY_STATIC,RTC_SCENE_HIGH_QUALITY);
 
     rtcDeleteDevice(g_device); g_device = nullptr;
+    Pause();
+    Benchmark_Topology(g_ispc_scene,iterations_static_static,init);
   }
 
 /* called by the C++ code to render */
@@ -671,6 +671,773 @@ namespace embree
     }
   };
 
+  struct SoftwareCacheStatsTest : public VerifyApplication::Test
+  {
+    SoftwareCacheStatsTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      if (!rtcDeviceGetParameter1i(device,RTC_CONFIG_SUBDIV_GEOMETRY))
+        return VerifyApplication::SKIPPED;
+
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_SIZE,16*1024*1024);
+      AssertNoError(device);
+      if (rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_SIZE) != 16*1024*1024)
+        return VerifyApplication::FAILED;
+
+      VerifyScene scene(device,RTC_SCENE_STATIC,(RTCAlgorithmFlags)(RTC_INTERSECT1 | RTC_INTERPOLATE));
+      unsigned geomID = scene.addSubdivSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,5,4).first;
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_RESET_STATISTICS,0);
+      AssertNoError(device);
+      float P[3], dPdu[3], dPdv[3];
+      for (size_t i=0; i<2; i++)
+        rtcInterpolate(scene,geomID,0,0.5f,0.5f,RTC_VERTEX_BUFFER,P,dPdu,dPdv,3);
+      AssertNoError(device);
+
+      const ssize_t accesses = rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_ACCESSES);
+      const ssize_t hits     = rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_HITS);
+      const ssize_t misses   = rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_MISSES);
+      const ssize_t used     = rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_USED_BYTES);
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) (accesses == hits+misses && misses >= 1 && hits >= 1 && used > 0);
+    }
+  };
+
+  struct TaskingIdlePolicyTest : public VerifyApplication::Test
+  {
+    TaskingIdlePolicyTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    /* stalls the build once such that the other worker threads run out of work */
+    static std::atomic<bool> stalled;
+    static bool stallBuild(void* ptr, const double n) 
+    {
+      if (!stalled.exchange(true)) sleepSeconds(0.05);
+      return true;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      if (rtcDeviceGetParameter1i(device,RTC_CONFIG_TASKING_SYSTEM) != 0)
+        return VerifyApplication::SKIPPED;
+
+      rtcDeviceSetParameter1i(device,RTC_TASKING_IDLE_SPIN_ROUNDS,1);
+      rtcDeviceSetParameter1i(device,RTC_TASKING_IDLE_BACKOFF_ROUNDS,2);
+      rtcDeviceSetParameter1i(device,RTC_TASKING_IDLE_PARKING,1);
+      AssertNoError(device);
+      bool passed = rtcDeviceGetParameter1i(device,RTC_TASKING_IDLE_PARKING) == 1;
+      passed &= rtcDeviceGetParameter1i(device,RTC_TASKING_IDLE_SPIN_ROUNDS) == 1;
+
+      /* builds have to complete correctly with parked worker threads */
+      const ssize_t numParks0 = rtcDeviceGetParameter1i(device,RTC_TASKING_IDLE_PARK_COUNT);
+      for (size_t i=0; i<4 && passed; i++)
+      {
+        VerifyScene scene(device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+        scene.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,500);
+        stalled = false;
+        rtcSetProgressMonitorFunction(scene,stallBuild,nullptr);
+        rtcCommit (scene);
+        AssertNoError(device);
+        RTCRay ray = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+        rtcIntersect(scene,ray);
+        passed &= ray.geomID == 0;
+      }
+      const ssize_t numParks1 = rtcDeviceGetParameter1i(device,RTC_TASKING_IDLE_PARK_COUNT);
+      
+      /* worker threads have to park while the build is stalled, there are no worker threads on single threaded machines */
+      if (getNumberOfLogicalThreads() > 1)
+        passed &= numParks1 > numParks0;
+      if (!silent) { printf(" (%zi parks)",numParks1-numParks0); fflush(stdout); }
+
+      /* the policy is per device, a second device keeps the default */
+      RTCDeviceRef device2 = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device2));
+      passed &= rtcDeviceGetParameter1i(device2,RTC_TASKING_IDLE_PARKING) == 0;
+      passed &= rtcDeviceGetParameter1i(device ,RTC_TASKING_IDLE_PARKING) == 1;
+      AssertNoError(device2);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  std::atomic<bool> TaskingIdlePolicyTest::stalled(false);
+
+  struct TessellationCameraTest : public VerifyApplication::Test
+  {
+    TessellationCameraTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    /* counts the number of tessellated vertices, displaces nothing */
+    static std::atomic<size_t> numDisplacedVertices;
+    static void countVertices(void* ptr, unsigned geomID, unsigned primID, unsigned time, 
+                              const float* u, const float* v, const float* nx, const float* ny, const float* nz, 
+                              float* px, float* py, float* pz, size_t N) {
+      numDisplacedVertices += N;
+    }
+
+    static RTCTessellationCamera makeCamera(float z)
+    {
+      RTCTessellationCamera camera;
+      camera.position[0] = 0.0f; camera.position[1] = 0.0f; camera.position[2] = z;
+      camera.pixelScale = 512.0f;
+      camera.edgeLength = 4.0f;
+      camera.maxLevel = 32.0f;
+      return camera;
+    }
+
+    /* tessellates a sphere for some camera and returns the number of generated vertices */
+    std::pair<bool,size_t> tessellate(VerifyApplication* state, const RTCDeviceRef& device, float cameraZ)
+    {
+      VerifyScene scene(device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+      unsigned geom = scene.addGeometry2(RTC_GEOMETRY_STATIC,SceneGraph::createSubdivSphere(zero,1.0f,8,4)).first;
+      rtcSetDisplacementFunction2(scene,geom,countVertices,nullptr);
+      RTCTessellationCamera camera = makeCamera(cameraZ);
+      rtcSetTessellationCamera(scene,geom,&camera);
+      numDisplacedVertices = 0;
+      rtcCommit (scene);
+      AssertNoError(device);
+      const size_t numVertices = numDisplacedVertices;
+
+      /* levels vary over the sphere, shared edges have to get identical
+       * levels, otherwise rays from inside escape through cracks */
+      const size_t numRays = size_t(20000*state->intensity);
+      size_t numFailures = 0;
+      for (size_t i=0; i<numRays; i++) 
+      {
+        Vec3fa dir = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+        RTCRay ray = makeRay(0.1f*(2.0f*random_Vec3fa() - Vec3fa(1.0f)),dir); 
+        rtcIntersect(scene,ray);
+        numFailures += ray.geomID == RTC_INVALID_GEOMETRY_ID;
+      }
+      AssertNoError(device);
+      return std::make_pair(double(numFailures) <= 0.00002*double(numRays),numVertices);
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      VerifyScene scene(device,RTC_SCENE_DYNAMIC,aflags);
+      AssertNoError(device);
+      unsigned geom0 = scene.addSubdivSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,10,4).first;
+      unsigned geom1 = scene.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,50).first;
+      AssertNoError(device);
+
+      RTCTessellationCamera camera = makeCamera(-5.0f);
+      rtcSetTessellationCamera(scene,geom0,&camera);
+      AssertNoError(device);
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      /* triangle meshes do not support tessellation */
+      rtcSetTessellationCamera(scene,geom1,&camera);
+      AssertError(device,RTC_INVALID_OPERATION);
+
+      /* invalid camera parameters */
+      camera.edgeLength = 0.0f;
+      rtcSetTessellationCamera(scene,geom0,&camera);
+      AssertError(device,RTC_INVALID_ARGUMENT);
+
+      /* disable view dependent tessellation again */
+      rtcSetTessellationCamera(scene,geom0,nullptr);
+      AssertNoError(device);
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      /* levels have to decrease with the camera distance and the tessellation has to stay crack free */
+      bool passed = true;
+      std::pair<bool,size_t> nearCamera = tessellate(state,device,-1.5f);
+      std::pair<bool,size_t> farCamera  = tessellate(state,device,-50.0f);
+      passed &= nearCamera.first && farCamera.first;
+      passed &= nearCamera.second > 2*farCamera.second;
+      if (!silent) { printf(" (%zu vs. %zu vertices)",nearCamera.second,farCamera.second); fflush(stdout); }
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  std::atomic<size_t> TessellationCameraTest::numDisplacedVertices(0);
+
+  struct CommitPriorityTest : public VerifyApplication::Test
+  {
+    CommitPriorityTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    static void commitLow(void* ptr) {
+      rtcCommitWithPriority((RTCScene)ptr,RTC_COMMIT_PRIORITY_LOW);
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      VerifyScene scene0(device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+      scene0.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,1000);
+      VerifyScene scene1(device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+      scene1.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,10);
+      AssertNoError(device);
+
+      /* a large background build and a small interactive build run concurrently */
+      thread_t thread = createThread(commitLow,(RTCScene)scene0,DEFAULT_STACK_SIZE);
+      rtcCommitWithPriority(scene1,RTC_COMMIT_PRIORITY_HIGH);
+      join(thread);
+      AssertNoError(device);
+
+      rtcCommitWithPriority(scene1,RTCCommitPriority(3));
+      AssertError(device,RTC_INVALID_ARGUMENT);
+
+      /* both scenes have to be built correctly */
+      bool passed = true;
+      RTCRay ray0 = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); rtcIntersect(scene0,ray0);
+      RTCRay ray1 = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); rtcIntersect(scene1,ray1);
+      passed &= ray0.geomID == 0 && ray1.geomID == 0;
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct CancelCommitTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    CancelCommitTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      VerifyScene scene(device,sflags,RTC_INTERSECT1);
+      for (size_t i=0; i<16; i++)
+        scene.addSphere(sampler,RTC_GEOMETRY_STATIC,Vec3fa(float(i),0.0f,0.0f),0.25f,100);
+      AssertNoError(device);
+
+      /* cancelled commit leaves scene uncommitted */
+      rtcCancelCommit(scene);
+      AssertNoError(device);
+      rtcCommit(scene);
+      AssertError(device,RTC_CANCELLED);
+      
+      /* commit in small time slices until the build finished */
+      size_t numSlices = 0;
+      while (!rtcCommitTimeSliced(scene,1)) {
+        AssertNoError(device);
+        if (++numSlices > 64) return VerifyApplication::FAILED;
+      }
+      AssertNoError(device);
+
+      /* a cancel request never outlives the commit it got consumed by */
+      rtcCancelCommit(scene);
+      rtcCancelCommit(scene);
+      rtcCommit(scene);
+      AssertNoError(device);
+      rtcCommit(scene);
+      AssertNoError(device);
+
+      /* all geometries have to be hit */
+      bool passed = true;
+      for (size_t i=0; i<16; i++) {
+        RTCRay ray = makeRay(Vec3fa(float(i),10.0f,0.0f),Vec3fa(0,-1,0)); 
+        rtcIntersect(scene,ray);
+        passed &= ray.geomID == i;
+      }
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct CommitAsyncTest : public VerifyApplication::Test
+  {
+    CommitAsyncTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    static unsigned trace(RTCScene scene, float x) 
+    {
+      RTCRay ray = makeRay(Vec3fa(x,10.0f,0.0f),Vec3fa(0,-1,0)); 
+      rtcIntersect(scene,ray);
+      return ray.geomID;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+
+      /* static scenes cannot get committed asynchronously */
+      VerifyScene scene0(device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+      scene0.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,10);
+      rtcCommitAsync(scene0);
+      AssertError(device,RTC_INVALID_OPERATION);
+
+      VerifyScene scene(device,RTC_SCENE_DYNAMIC,RTC_INTERSECT1);
+      unsigned geom0 = scene.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,50).first;
+      rtcCommit(scene);
+      AssertNoError(device);
+
+      /* the previous generation gets traced during the asynchronous build */
+      bool passed = true;
+      unsigned geom1 = scene.addSphere(sampler,RTC_GEOMETRY_STATIC,Vec3fa(10.0f,0.0f,0.0f),1.0f,500).first;
+      rtcCommitAsync(scene);
+      AssertNoError(device);
+      while (!rtcCommitAsyncFinish(scene,false)) {
+        passed &= trace(scene,0.0f) == geom0;
+        passed &= trace(scene,10.0f) == RTC_INVALID_GEOMETRY_ID;
+      }
+      AssertNoError(device);
+      passed &= trace(scene,0.0f) == geom0;
+      passed &= trace(scene,10.0f) == geom1;
+
+      /* deleted geometries stay alive until the next generation is current */
+      rtcDeleteGeometry(scene,geom0);
+      rtcCommitAsync(scene);
+      passed &= rtcCommitAsyncFinish(scene,true);
+      AssertNoError(device);
+      passed &= trace(scene,0.0f) == RTC_INVALID_GEOMETRY_ID;
+      passed &= trace(scene,10.0f) == geom1;
+
+      /* both generations have to pick up modifications */
+      for (size_t i=0; i<3; i++) {
+        rtcUpdate(scene,geom1);
+        rtcCommitAsync(scene);
+        passed &= rtcCommitAsyncFinish(scene,true);
+        passed &= trace(scene,10.0f) == geom1;
+      }
+      rtcCommit(scene);
+      AssertNoError(device);
+      passed &= trace(scene,10.0f) == geom1;
+
+      /* the scene cannot get modified while an asynchronous commit builds from it */
+      rtcUpdate(scene,geom1);
+      rtcCommitAsync(scene);
+      AssertNoError(device);
+      rtcUpdate(scene,geom1);
+      AssertError(device,RTC_INVALID_OPERATION);
+      rtcDisable(scene,geom1);
+      AssertError(device,RTC_INVALID_OPERATION);
+      rtcDeleteGeometry(scene,geom1);
+      AssertError(device,RTC_INVALID_OPERATION);
+      rtcNewTriangleMesh(scene,RTC_GEOMETRY_STATIC,1,3);
+      AssertError(device,RTC_INVALID_OPERATION);
+      passed &= rtcCommitAsyncFinish(scene,true);
+      AssertNoError(device);
+      passed &= trace(scene,10.0f) == geom1;
+
+      /* a synchronous commit makes the result of a running asynchronous commit current */
+      unsigned geom2 = scene.addSphere(sampler,RTC_GEOMETRY_STATIC,Vec3fa(20.0f,0.0f,0.0f),1.0f,50).first;
+      rtcCommitAsync(scene);
+      rtcCommit(scene);
+      AssertNoError(device);
+      passed &= trace(scene,10.0f) == geom1;
+      passed &= trace(scene,20.0f) == geom2;
+      passed &= rtcCommitAsyncFinish(scene,true);
+      AssertNoError(device);
+
+      /* a cancelled asynchronous commit keeps the current generation and can get repeated */
+      rtcUpdate(scene,geom1);
+      rtcCommitAsync(scene);
+      rtcCancelCommit(scene);
+      rtcCommitAsyncFinish(scene,true);
+      RTCError error = rtcDeviceGetError(device);
+      passed &= error == RTC_NO_ERROR || error == RTC_CANCELLED;
+      passed &= trace(scene,20.0f) == geom2;
+      rtcCommitAsync(scene);
+      passed &= rtcCommitAsyncFinish(scene,true);
+      AssertNoError(device);
+      passed &= trace(scene,10.0f) == geom1;
+      passed &= trace(scene,20.0f) == geom2;
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  static std::atomic<size_t> rebuild_presizing_num_allocations(0);
+
+  struct RebuildPresizingTest : public VerifyApplication::Test
+  {
+    RebuildPresizingTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    static bool memoryMonitor(void* userPtr, const ssize_t bytes, const bool /*post*/)
+    {
+      if (bytes > 0) rebuild_presizing_num_allocations++;
+      return true;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      VerifyScene scene(device,RTC_SCENE_DYNAMIC,RTC_INTERSECT1);
+      unsigned geom = scene.addSphere(sampler,RTC_GEOMETRY_DYNAMIC,zero,1.0f,500).first;
+      rtcDeviceSetMemoryMonitorFunction2(device,memoryMonitor,nullptr);
+      AssertNoError(device);
+
+      /* after two builds the allocators know how much memory a rebuild requires */
+      bool passed = true;
+      for (size_t i=0; i<6; i++)
+      {
+        if (i == 2) rebuild_presizing_num_allocations = 0;
+        rtcUpdate(scene,geom);
+        rtcCommit(scene);
+        AssertNoError(device);
+        RTCRay ray = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+        rtcIntersect(scene,ray);
+        passed &= ray.geomID == geom;
+      }
+      if (!silent) { printf(" (%zu allocations)",size_t(rebuild_presizing_num_allocations)); fflush(stdout); }
+      passed &= rebuild_presizing_num_allocations == 0;
+      rtcDeviceSetMemoryMonitorFunction2(device,nullptr,nullptr);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct MemoryRecycleTest : public VerifyApplication::Test
+  {
+    MemoryRecycleTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      const ssize_t maxBytes = 256*1024*1024;
+      rtcDeviceSetParameter1i(device,RTC_MEMORY_RECYCLE_MAX_BYTES,maxBytes);
+      AssertNoError(device);
+      bool passed = rtcDeviceGetParameter1i(device,RTC_MEMORY_RECYCLE_MAX_BYTES) == maxBytes;
+
+      /* each frame releases the memory of the previous frame */
+      for (size_t i=0; i<4; i++)
+      {
+        VerifyScene scene(device,RTC_SCENE_DYNAMIC,RTC_INTERSECT1);
+        unsigned geom = scene.addSphere(sampler,RTC_GEOMETRY_DYNAMIC,zero,1.0f,200+50*i).first;
+        rtcCommit(scene);
+        AssertNoError(device);
+        RTCRay ray = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+        rtcIntersect(scene,ray);
+        passed &= ray.geomID == geom;
+      }
+      const ssize_t numRecycled = rtcDeviceGetParameter1i(device,RTC_MEMORY_RECYCLE_COUNT);
+      if (!silent) { printf(" (%zi blocks recycled)",numRecycled); fflush(stdout); }
+      passed &= numRecycled > 0;
+      passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_RECYCLED_BYTES) > 0;
+      passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_RECYCLED_BYTES) <= maxBytes;
+
+      /* disabling recycling unmaps all kept memory */
+      rtcDeviceSetParameter1i(device,RTC_MEMORY_RECYCLE_MAX_BYTES,0);
+      passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_RECYCLED_BYTES) == 0;
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct HugePagePolicyTest : public VerifyApplication::Test
+  {
+    HugePagePolicyTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      bool passed = rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_MODE) == 2;
+      rtcDeviceSetParameter1i(device,RTC_HUGE_PAGE_MODE,4);
+      AssertError(device,RTC_INVALID_ARGUMENT);
+
+      /* also allocate large build arrays directly from the OS */
+      rtcDeviceSetParameter1i(device,RTC_HUGE_PAGE_MIN_BYTES_ACCEL,0);
+      rtcDeviceSetParameter1i(device,RTC_HUGE_PAGE_MIN_BYTES_BUILD,2*1024*1024);
+      AssertNoError(device);
+      passed &= rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_MIN_BYTES_ACCEL) == 0;
+      passed &= rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_MIN_BYTES_BUILD) == 2*1024*1024;
+
+      for (ssize_t mode=0; mode<4; mode++)
+      {
+        rtcDeviceSetParameter1i(device,RTC_HUGE_PAGE_MODE,mode);
+        AssertNoError(device);
+        passed &= rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_MODE) == mode;
+        {
+          VerifyScene scene(device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+          unsigned geom = scene.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,500).first;
+          rtcCommit(scene);
+          AssertNoError(device);
+          RTCRay ray = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+          rtcIntersect(scene,ray);
+          passed &= ray.geomID == geom;
+
+          const ssize_t hugeBytes = rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_BYTES);
+          const ssize_t advisedBytes = rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_ADVISED_BYTES);
+          if (!silent) { printf(" (mode %zi: %zi MB huge, %zi MB advised)",mode,hugeBytes>>20,advisedBytes>>20); fflush(stdout); }
+          if (mode == 0) passed &= hugeBytes == 0 && advisedBytes == 0;
+          if (mode == 1) passed &= hugeBytes == 0;
+        }
+        
+        /* all pages got unmapped again */
+        passed &= rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_BYTES) == 0;
+        passed &= rtcDeviceGetParameter1i(device,RTC_HUGE_PAGE_ADVISED_BYTES) == 0;
+      }
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct MemoryStatisticsTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    MemoryStatisticsTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      VerifyScene scene(device,sflags,aflags);
+      scene.addSphere(sampler,RTC_GEOMETRY_STATIC,zero,1.0f,100);
+      scene.addHair(sampler,RTC_GEOMETRY_STATIC,Vec3fa(0,0,0),1.0f,1.0f,100);
+      AssertNoError(device);
+
+      /* statistics require a committed scene */
+      RTCAccelMemoryStatistics stats[16];
+      rtcGetMemoryStatistics(scene,stats,16);
+      AssertError(device,RTC_INVALID_OPERATION);
+
+      rtcCommit(scene);
+      AssertNoError(device);
+      const size_t num = rtcGetMemoryStatistics(scene,stats,16);
+      AssertNoError(device);
+      bool passed = num >= 2 && num <= 16;
+      size_t bytesTriangles = 0, bytesHair = 0;
+      for (size_t i=0; i<min(num,size_t(16)); i++)
+      {
+        const std::string name = stats[i].name ? stats[i].name : "";
+        const size_t bytes = stats[i].bytesNodes+stats[i].bytesLeaves;
+        if (!silent) { printf(" (%s: %zu KB)",name.c_str(),bytes>>10); fflush(stdout); }
+        if (name.find("triangle") != std::string::npos) bytesTriangles += bytes;
+        if (name.find("bezier"  ) != std::string::npos) bytesHair += bytes;
+        passed &= stats[i].bytesTessellationCache == 0;
+      }
+      passed &= bytesTriangles > 0;
+      passed &= bytesHair > 0;
+
+      /* counting works without output array */
+      passed &= rtcGetMemoryStatistics(scene,nullptr,0) == num;
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct FlatBVHBuildTest : public VerifyApplication::Test
+  {
+    RTCBuildQuality quality;
+    unsigned branchingFactor;
+
+    FlatBVHBuildTest (std::string name, int isa, RTCBuildQuality quality, unsigned branchingFactor)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), quality(quality), branchingFactor(branchingFactor) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+
+      const size_t N = 10000;
+      avector<RTCBuildPrimitive> prims(N);
+      for (size_t i=0; i<N; i++) 
+      {
+        const Vec3fa p = 100.0f*RandomSampler_get3D(sampler);
+        const BBox3fa b(p,p+RandomSampler_get3D(sampler));
+        prims[i].lower_x = b.lower.x; prims[i].lower_y = b.lower.y; prims[i].lower_z = b.lower.z; prims[i].geomID = 0;
+        prims[i].upper_x = b.upper.x; prims[i].upper_y = b.upper.y; prims[i].upper_z = b.upper.z; prims[i].primID = (int) i;
+      }
+
+      RTCBuildSettings settings = rtcDefaultBuildSettings();
+      settings.quality = quality;
+      settings.maxBranchingFactor = branchingFactor;
+      settings.maxLeafSize = 4;
+      RTCBVH bvh = rtcNewBVH(device);
+      RTCFlatBVH flat;
+      rtcBuildBVHFlat(bvh,settings,prims.data(),N,nullptr,nullptr,nullptr,flat);
+      AssertNoError(device);
+      bool passed = flat.branchingFactor == branchingFactor && flat.numLeaves > 0 && flat.numNodes < flat.numLeaves;
+
+      /* every primitive is referenced exactly once and child bounds enclose all primitives below */
+      std::vector<size_t> count(N,0);
+      std::function<BBox3fa(unsigned)> check = [&] (unsigned ref) -> BBox3fa
+      {
+        BBox3fa bounds = empty;
+        if (ref & RTC_FLAT_BVH_LEAF) 
+        {
+          const unsigned leaf = ref & ~RTC_FLAT_BVH_LEAF;
+          passed &= leaf < flat.numLeaves && flat.leafSize[leaf] <= 4;
+          for (unsigned i=flat.leafBegin[leaf]; i<flat.leafBegin[leaf]+flat.leafSize[leaf]; i++) {
+            count[prims[i].primID]++;
+            bounds.extend(BBox3fa(Vec3fa(prims[i].lower_x,prims[i].lower_y,prims[i].lower_z),
+                                  Vec3fa(prims[i].upper_x,prims[i].upper_y,prims[i].upper_z)));
+          }
+          return bounds;
+        }
+        passed &= ref < flat.numNodes;
+        for (size_t c=0; c<branchingFactor; c++)
+        {
+          const size_t slot = ref*branchingFactor+c;
+          if (flat.children[slot] == RTC_FLAT_BVH_EMPTY) continue;
+          const BBox3fa cbounds(Vec3fa(flat.lower_x[slot],flat.lower_y[slot],flat.lower_z[slot]),
+                                Vec3fa(flat.upper_x[slot],flat.upper_y[slot],flat.upper_z[slot]));
+          const BBox3fa childBounds = check(flat.children[slot]);
+          passed &= subset(childBounds,cbounds);
+          bounds.extend(childBounds);
+        }
+        return bounds;
+      };
+      check(flat.root);
+      for (size_t i=0; i<N; i++) passed &= count[i] == 1;
+
+      /* refit after moving all primitives */
+      for (size_t i=0; i<N; i++) {
+        const Vec3fa d = 10.0f*RandomSampler_get3D(sampler);
+        prims[i].lower_x += d.x; prims[i].lower_y += d.y; prims[i].lower_z += d.z;
+        prims[i].upper_x += d.x; prims[i].upper_y += d.y; prims[i].upper_z += d.z;
+      }
+      rtcRefitBVH(bvh,prims.data(),N);
+      AssertNoError(device);
+      std::fill(count.begin(),count.end(),0);
+      check(flat.root);
+      for (size_t i=0; i<N; i++) passed &= count[i] == 1;
+
+      /* refitting requires the primitives of the build */
+      rtcRefitBVH(bvh,prims.data(),N-1);
+      AssertError(device,RTC_INVALID_ARGUMENT);
+      
+      rtcDeleteBVH(bvh);
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct MotionBlurBVHBuildTest : public VerifyApplication::Test
+  {
+    struct Node
+    {
+      size_t numChildren;  //!< 0 for leaves
+      LBBox3fa bounds[4];
+      Node* children[4];
+      unsigned primIDs[4];
+      size_t numPrims;
+
+      static void* create (RTCThreadLocalAllocator alloc, size_t numChildren, void* userPtr) 
+      {
+        Node* node = (Node*) rtcThreadLocalAlloc(alloc,sizeof(Node),16);
+        node->numChildren = numChildren;
+        node->numPrims = 0;
+        return node;
+      }
+
+      static void setChildren (void* nodePtr, void** childPtr, size_t numChildren, void* userPtr) {
+        for (size_t i=0; i<numChildren; i++) ((Node*)nodePtr)->children[i] = (Node*) childPtr[i];
+      }
+
+      static void setBounds (void* nodePtr, const RTCBounds** bounds0, const RTCBounds** bounds1, size_t numChildren, void* userPtr) {
+        for (size_t i=0; i<numChildren; i++) ((Node*)nodePtr)->bounds[i] = LBBox3fa(*(const BBox3fa*)bounds0[i],*(const BBox3fa*)bounds1[i]);
+      }
+
+      static void* createLeaf (RTCThreadLocalAllocator alloc, const RTCBuildPrimitiveMB* prims, size_t numPrims, void* userPtr)
+      {
+        Node* node = (Node*) rtcThreadLocalAlloc(alloc,sizeof(Node),16);
+        node->numChildren = 0;
+        node->numPrims = numPrims;
+        for (size_t i=0; i<min(numPrims,size_t(4)); i++) node->primIDs[i] = prims[i].primID;
+        return node;
+      }
+    };
+
+    MotionBlurBVHBuildTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+
+      const size_t N = 10000;
+      avector<RTCBuildPrimitiveMB> prims(N);
+      std::vector<LBBox3fa> bounds(N);
+      for (size_t i=0; i<N; i++) 
+      {
+        const Vec3fa p = 100.0f*RandomSampler_get3D(sampler);
+        const BBox3fa b0(p,p+RandomSampler_get3D(sampler));
+        const BBox3fa b1(b0.lower+10.0f*RandomSampler_get3D(sampler),b0.upper+10.0f*RandomSampler_get3D(sampler));
+        bounds[i] = LBBox3fa(b0,b1);
+        prims[i].lower0_x = b0.lower.x; prims[i].lower0_y = b0.lower.y; prims[i].lower0_z = b0.lower.z; prims[i].geomID = 0;
+        prims[i].upper0_x = b0.upper.x; prims[i].upper0_y = b0.upper.y; prims[i].upper0_z = b0.upper.z; prims[i].primID = (int) i;
+        prims[i].lower1_x = b1.lower.x; prims[i].lower1_y = b1.lower.y; prims[i].lower1_z = b1.lower.z;
+        prims[i].upper1_x = b1.upper.x; prims[i].upper1_y = b1.upper.y; prims[i].upper1_z = b1.upper.z;
+      }
+
+      RTCBuildSettings settings = rtcDefaultBuildSettings();
+      settings.maxBranchingFactor = 4;
+      settings.maxLeafSize = 4;
+      RTCBVH bvh = rtcNewBVH(device);
+      Node* root = (Node*) rtcBuildBVHMB(bvh,settings,prims.data(),N,Node::create,Node::setChildren,Node::setBounds,Node::createLeaf,nullptr,nullptr);
+      AssertNoError(device);
+      bool passed = root != nullptr;
+
+      /* every primitive is referenced exactly once and the linear child bounds enclose all primitives below at all times */
+      std::vector<size_t> count(N,0);
+      std::function<LBBox3fa(Node*)> check = [&] (Node* node) -> LBBox3fa
+      {
+        LBBox3fa lbounds = empty;
+        if (node->numChildren == 0) 
+        {
+          passed &= node->numPrims <= 4;
+          for (size_t i=0; i<min(node->numPrims,size_t(4)); i++) {
+            count[node->primIDs[i]]++;
+            lbounds.extend(bounds[node->primIDs[i]]);
+          }
+          return lbounds;
+        }
+        for (size_t c=0; c<node->numChildren; c++)
+        {
+          const LBBox3fa childBounds = check(node->children[c]);
+          for (float t=0.0f; t<=1.0f; t+=0.25f)
+            passed &= subset(childBounds.interpolate(t),node->bounds[c].interpolate(t));
+          lbounds.extend(childBounds);
+        }
+        return lbounds;
+      };
+      if (root) check(root);
+      for (size_t i=0; i<N; i++) passed &= count[i] == 1;
+
+      /* the primitive array got reordered */
+      std::fill(count.begin(),count.end(),0);
+      for (size_t i=0; i<N; i++) count[prims[i].primID]++;
+      for (size_t i=0; i<N; i++) passed &= count[i] == 1;
+
+      /* BVHs built with callbacks cannot get refitted */
+      rtcRefitBVH(bvh,nullptr,0);
+      AssertError(device,RTC_INVALID_OPERATION);
+
+      rtcDeleteBVH(bvh);
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
   struct FlagsTest : public VerifyApplication::Test
   {
     RTCSceneFlags sceneFlags;
@@ -1709,23 +2476,89 @@ namespace embree
       for (size_t i=0; i<M; i++) user_vertices0[i] = random_float();
       rtcSetBuffer(scene, geomID, RTC_USER_VERTEX_BUFFER0, user_vertices0.data(), 0, N*sizeof(float));
       AssertNoError(device);
-      
-      std::vector<float> user_vertices1(M);
-      for (size_t i=0; i<M; i++) user_vertices1[i] = random_float();
-      rtcSetBuffer(scene, geomID, RTC_USER_VERTEX_BUFFER1, user_vertices1.data(), 0, N*sizeof(float));
+      
+      std::vector<float> user_vertices1(M);
+      for (size_t i=0; i<M; i++) user_vertices1[i] = random_float();
+      rtcSetBuffer(scene, geomID, RTC_USER_VERTEX_BUFFER1, user_vertices1.data(), 0, N*sizeof(float));
+      AssertNoError(device);
+      
+      bool passed = true;
+      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER0,vertices0.data(),N,N);
+      //passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER1,vertices1.data(),N,N);
+      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER0,user_vertices0.data(),N,N);
+      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER1,user_vertices1.data(),N,N);
+      
+      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER0,vertices0.data(),1,N);
+      //passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER1,vertices1.data(),1,N);
+      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER0,user_vertices0.data(),1,N);
+      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER1,user_vertices1.data(),1,N);
+      
+      AssertNoError(device);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct InterpolateSubdivBatchTest : public VerifyApplication::Test
+  {
+    size_t N;
+
+    InterpolateSubdivBatchTest (std::string name, int isa, size_t N)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), N(N) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      size_t M = num_interpolation_vertices*N+16; // padds the arrays with some valid data
+
+      RTCSceneRef scene = rtcDeviceNewScene(device,RTC_SCENE_STATIC,RTC_INTERPOLATE);
+      AssertNoError(device);
+      unsigned int geomID = rtcNewSubdivisionMesh(scene, RTC_GEOMETRY_STATIC, num_interpolation_quad_faces, num_interpolation_quad_faces*4, num_interpolation_vertices, 0, 0, 0);
+      AssertNoError(device);
+      rtcSetBuffer(scene, geomID, RTC_INDEX_BUFFER,  interpolation_quad_indices , 0, sizeof(unsigned int));
+      rtcSetBuffer(scene, geomID, RTC_FACE_BUFFER,   interpolation_quad_faces,    0, sizeof(unsigned int));
+      AssertNoError(device);
+
+      std::vector<float> vertices0(M);
+      for (size_t i=0; i<M; i++) vertices0[i] = random_float();
+      rtcSetBuffer(scene, geomID, RTC_VERTEX_BUFFER0, vertices0.data(), 0, N*sizeof(float));
       AssertNoError(device);
-      
+      rtcCommit(scene);
+      AssertNoError(device);
+
+      /* unsorted batch that is large enough to get evaluated patch by patch */
+      const size_t numUVs = 4099;
+      std::vector<int> valid(numUVs);
+      std::vector<unsigned> primIDs(numUVs);
+      std::vector<float> u(numUVs), v(numUVs);
+      for (size_t i=0; i<numUVs; i++) {
+        valid[i] = (i%7) ? -1 : 0;
+        primIDs[i] = random_int() % num_interpolation_quad_faces;
+        u[i] = random_float();
+        v[i] = random_float();
+      }
+      std::vector<float> P(numUVs*N,-1.0f), dPdu(numUVs*N,-1.0f), dPdv(numUVs*N,-1.0f);
+      rtcInterpolateN(scene,geomID,valid.data(),primIDs.data(),u.data(),v.data(),numUVs,RTC_VERTEX_BUFFER0,P.data(),dPdu.data(),dPdv.data(),N);
+      AssertNoError(device);
+
       bool passed = true;
-      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER0,vertices0.data(),N,N);
-      //passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER1,vertices1.data(),N,N);
-      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER0,user_vertices0.data(),N,N);
-      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER1,user_vertices1.data(),N,N);
-      
-      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER0,vertices0.data(),1,N);
-      //passed &= checkSubdivInterpolation(device,scene,geomID,RTC_VERTEX_BUFFER1,vertices1.data(),1,N);
-      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER0,user_vertices0.data(),1,N);
-      passed &= checkSubdivInterpolation(device,scene,geomID,RTC_USER_VERTEX_BUFFER1,user_vertices1.data(),1,N);
-      
+      for (size_t i=0; i<numUVs; i++)
+      {
+        float P1[256], dPdu1[256], dPdv1[256];
+        if (valid[i]) rtcInterpolate(scene,geomID,primIDs[i],u[i],v[i],RTC_VERTEX_BUFFER0,P1,dPdu1,dPdv1,N);
+        for (size_t j=0; j<N; j++)
+        {
+          if (valid[i]) {
+            passed &= fabsf(P1[j]-P[j*numUVs+i]) < 1E-4f;
+            passed &= fabsf(dPdu1[j]-dPdu[j*numUVs+i]) < 1E-3f;
+            passed &= fabsf(dPdv1[j]-dPdv[j*numUVs+i]) < 1E-3f;
+          } else {
+            passed &= P[j*numUVs+i] == -1.0f;
+          }
+        }
+      }
       AssertNoError(device);
 
       return (VerifyApplication::TestReturnValue) passed;
@@ -2009,6 +2842,363 @@ namespace embree
     }
   };
 
+  struct UserGeometryLeafTest : public VerifyApplication::IntersectTest
+  {
+    struct Spheres
+    {
+      Spheres (size_t N) : spheres(N), geomID(0), maxItems(0) {}
+      
+      avector<Sphere> spheres;
+      unsigned geomID;
+      std::atomic<size_t> maxItems;  //!< maximal number of items passed to a leaf callback
+    };
+
+    static void bounds(Spheres* spheres, size_t item, RTCBounds& bounds_o) {
+      (BBox3fa&) bounds_o = spheres->spheres[item].bounds();
+    }
+
+    static float intersectSphere(RTCRayN* rays, size_t N, size_t i, const Sphere& sphere)
+    {
+      const Vec3fa org(RTCRayN_org_x(rays,N,i),RTCRayN_org_y(rays,N,i),RTCRayN_org_z(rays,N,i));
+      const Vec3fa dir(RTCRayN_dir_x(rays,N,i),RTCRayN_dir_y(rays,N,i),RTCRayN_dir_z(rays,N,i));
+      const Vec3fa v = org-sphere.pos;
+      const float A = dot(dir,dir);
+      const float B = 2.0f*dot(v,dir);
+      const float C = dot(v,v) - sqr(sphere.r);
+      const float D = B*B - 4.0f*A*C;
+      if (D < 0.0f) return inf;
+      const float t = (-B-sqrt(D))/(2.0f*A);
+      if (t < RTCRayN_tnear(rays,N,i) || t > RTCRayN_tfar(rays,N,i)) return inf;
+      return t;
+    }
+
+    static void recordItems(Spheres* spheres, size_t M)
+    {
+      size_t m = spheres->maxItems;
+      while (M > m && !spheres->maxItems.compare_exchange_weak(m,M));
+    }
+
+    static void intersectNM(const int* valid, Spheres* spheres, const RTCIntersectContext* context, RTCRayN* rays, size_t N, const unsigned* items, size_t M)
+    {
+      recordItems(spheres,M);
+      for (size_t i=0; i<N; i++)
+      {
+        if (valid[i] != -1) continue;
+        for (size_t j=0; j<M; j++) 
+        {
+          const Sphere& sphere = spheres->spheres[items[j]];
+          const float t = intersectSphere(rays,N,i,sphere);
+          if (t == float(inf)) continue;
+          RTCRayN_tfar(rays,N,i) = t;
+          RTCRayN_u(rays,N,i) = 0.0f;
+          RTCRayN_v(rays,N,i) = 0.0f;
+          RTCRayN_geomID(rays,N,i) = spheres->geomID;
+          RTCRayN_primID(rays,N,i) = items[j];
+          const Vec3fa Ng = Vec3fa(RTCRayN_org_x(rays,N,i),RTCRayN_org_y(rays,N,i),RTCRayN_org_z(rays,N,i)) 
+            + t*Vec3fa(RTCRayN_dir_x(rays,N,i),RTCRayN_dir_y(rays,N,i),RTCRayN_dir_z(rays,N,i)) - sphere.pos;
+          RTCRayN_Ng_x(rays,N,i) = Ng.x;
+          RTCRayN_Ng_y(rays,N,i) = Ng.y;
+          RTCRayN_Ng_z(rays,N,i) = Ng.z;
+        }
+      }
+    }
+
+    static void occludedNM(const int* valid, Spheres* spheres, const RTCIntersectContext* context, RTCRayN* rays, size_t N, const unsigned* items, size_t M)
+    {
+      recordItems(spheres,M);
+      for (size_t i=0; i<N; i++)
+      {
+        if (valid[i] != -1) continue;
+        for (size_t j=0; j<M; j++) {
+          if (intersectSphere(rays,N,i,spheres->spheres[items[j]]) != float(inf))
+            RTCRayN_geomID(rays,N,i) = 0;
+        }
+      }
+    }
+
+    UserGeometryLeafTest (std::string name, int isa, IntersectMode imode, IntersectVariant ivariant)
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      /* group 4 user primitives into each leaf */
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa)+",object_accel_min_leaf_size=4,object_accel_max_leaf_size=4";
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      if (!supportsIntersectMode(device,imode))
+        return VerifyApplication::SKIPPED;
+
+      /* grid of 16x16 spheres */
+      const size_t R = 16;
+      Spheres spheres(R*R);
+      for (size_t y=0; y<R; y++)
+        for (size_t x=0; x<R; x++)
+          spheres.spheres[y*R+x] = Sphere(Vec3fa(float(x),float(y),0.0f),0.4f);
+
+      RTCSceneRef scene = rtcDeviceNewScene(device,RTC_SCENE_STATIC,to_aflags(imode));
+      unsigned geomID = spheres.geomID = rtcNewUserGeometry3(scene,RTC_GEOMETRY_STATIC,R*R,1);
+      rtcSetUserData(scene,geomID,&spheres);
+      rtcSetBoundsFunction(scene,geomID,(RTCBoundsFunc)bounds);
+      rtcSetIntersectFunctionNM(scene,geomID,(RTCIntersectFuncNM)intersectNM);
+      rtcSetOccludedFunctionNM(scene,geomID,(RTCOccludedFuncNM)occludedNM);
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      size_t primIDs[256];
+      RTCRay rays[256];
+      for (size_t i=0; i<256; i++)
+      {
+        primIDs[i] = RandomSampler_getInt(sampler) % (R*R);
+        const Vec3fa d = 0.2f*(RandomSampler_get3D(sampler)-Vec3fa(0.5f));
+        const Vec3fa org = spheres.spheres[primIDs[i]].pos + Vec3fa(d.x,d.y,-5.0f);
+        rays[i] = makeRay(org,Vec3fa(0.0f,0.0f,1.0f));
+      }
+      IntersectWithMode(imode,ivariant,scene,rays,256);
+
+      for (size_t i=0; i<256; i++)
+      {
+        if (rays[i].geomID != geomID) return VerifyApplication::FAILED;
+        if (ivariant & VARIANT_OCCLUDED) continue;
+
+        if (rays[i].primID != primIDs[i]) return VerifyApplication::FAILED;
+        const Sphere& sphere = spheres.spheres[primIDs[i]];
+        const Vec3fa org(rays[i].org[0],rays[i].org[1],rays[i].org[2]);
+        const float h = sqr(org.x-sphere.pos.x) + sqr(org.y-sphere.pos.y);
+        if (abs(rays[i].tfar - (5.0f-sqrt(sqr(sphere.r)-h))) > 1E-4f) return VerifyApplication::FAILED;
+      }
+
+      /* streams invoke the callback for single items */
+      if (to_aflags(imode) != RTC_INTERSECT_STREAM && spheres.maxItems < 2)
+        return VerifyApplication::FAILED;
+
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct PointHitTest : public VerifyApplication::IntersectTest
+  {
+    enum Type { SPHERE, DISC, ORIENTED_DISC };
+    Type type;
+    size_t numTimeSteps;
+
+    PointHitTest (std::string name, int isa, Type type, size_t numTimeSteps, IntersectMode imode, IntersectVariant ivariant)
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), type(type), numTimeSteps(numTimeSteps) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      if (!supportsIntersectMode(device,imode))
+        return VerifyApplication::SKIPPED;
+      if (!rtcDeviceGetParameter1i(device,RTC_CONFIG_POINT_GEOMETRY))
+        return VerifyApplication::SKIPPED;
+
+      /* grid of 16x16 points that move by 2 units along z in the second time step */
+      const size_t R = 16;
+      const float r = 0.4f;
+      RTCSceneRef scene = rtcDeviceNewScene(device,RTC_SCENE_STATIC,to_aflags(imode));
+      unsigned geomID = RTC_INVALID_GEOMETRY_ID;
+      switch (type) {
+      case SPHERE       : geomID = rtcNewSpherePoints       (scene,RTC_GEOMETRY_STATIC,R*R,numTimeSteps); break;
+      case DISC         : geomID = rtcNewDiscPoints         (scene,RTC_GEOMETRY_STATIC,R*R,numTimeSteps); break;
+      case ORIENTED_DISC: geomID = rtcNewOrientedDiscPoints (scene,RTC_GEOMETRY_STATIC,R*R,numTimeSteps); break;
+      }
+      AssertNoError(device);
+
+      for (size_t t=0; t<numTimeSteps; t++)
+      {
+        Vec3fa* vertices = (Vec3fa*) rtcMapBuffer(scene,geomID,RTCBufferType(RTC_VERTEX_BUFFER0+t));
+        for (size_t y=0; y<R; y++)
+          for (size_t x=0; x<R; x++)
+            vertices[y*R+x] = Vec3fa(float(x),float(y),2.0f*float(t),r);
+        rtcUnmapBuffer(scene,geomID,RTCBufferType(RTC_VERTEX_BUFFER0+t));
+
+        if (type != ORIENTED_DISC) continue;
+        Vec3fa* normals = (Vec3fa*) rtcMapBuffer(scene,geomID,RTCBufferType(RTC_NORMAL_BUFFER0+t));
+        for (size_t i=0; i<R*R; i++) normals[i] = Vec3fa(0.0f,0.0f,-1.0f);
+        rtcUnmapBuffer(scene,geomID,RTCBufferType(RTC_NORMAL_BUFFER0+t));
+      }
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      /* rays at time 0.5 see all points shifted by 1 along z */
+      const float dz = numTimeSteps == 1 ? 0.0f : 1.0f;
+      size_t primIDs[256];
+      RTCRay rays[256];
+      for (size_t i=0; i<256; i++)
+      {
+        primIDs[i] = RandomSampler_getInt(sampler) % (R*R);
+        const Vec3fa d = 0.2f*(RandomSampler_get3D(sampler)-Vec3fa(0.5f));
+        const Vec3fa org = Vec3fa(float(primIDs[i]%R)+d.x,float(primIDs[i]/R)+d.y,-5.0f);
+        rays[i] = makeRay(org,Vec3fa(0.0f,0.0f,1.0f));
+        rays[i].time = 0.5f;
+      }
+      IntersectWithMode(imode,ivariant,scene,rays,256);
+
+      for (size_t i=0; i<256; i++)
+      {
+        if (rays[i].geomID != geomID) return VerifyApplication::FAILED;
+        if (ivariant & VARIANT_OCCLUDED) continue;
+
+        if (rays[i].primID != primIDs[i]) return VerifyApplication::FAILED;
+        const float px = float(primIDs[i]%R), py = float(primIDs[i]/R);
+        const float h = sqr(rays[i].org[0]-px) + sqr(rays[i].org[1]-py);
+        const float t = type == SPHERE ? 5.0f+dz-sqrt(sqr(r)-h) : 5.0f+dz;
+        if (abs(rays[i].tfar - t) > 1E-4f) return VerifyApplication::FAILED;
+        if (rays[i].Ng[2] >= 0.0f) return VerifyApplication::FAILED;
+      }
+
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct RoundLineHitTest : public VerifyApplication::IntersectTest
+  {
+    RoundLineHitTest (std::string name, int isa, IntersectMode imode, IntersectVariant ivariant)
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device));
+      if (!supportsIntersectMode(device,imode))
+        return VerifyApplication::SKIPPED;
+
+      /* strand along the x axis whose radius grows with each vertex */
+      const size_t N = 8;
+      RTCSceneRef scene = rtcDeviceNewScene(device,RTC_SCENE_STATIC,to_aflags(imode));
+      unsigned geomID = rtcNewRoundLineSegments(scene,RTC_GEOMETRY_STATIC,N-1,N,1);
+      AssertNoError(device);
+
+      Vec3fa* vertices = (Vec3fa*) rtcMapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+      for (size_t i=0; i<N; i++) vertices[i] = Vec3fa(float(i),0.0f,0.0f,0.2f+0.05f*float(i));
+      rtcUnmapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+      int* segments = (int*) rtcMapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+      for (size_t i=0; i<N-1; i++) segments[i] = int(i);
+      rtcUnmapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      /* rays perpendicular to the strand, and one ray along the strand into the first joint */
+      float height[256];
+      RTCRay rays[256];
+      for (size_t i=0; i<255; i++)
+      {
+        const float x = 0.2f+6.6f*RandomSampler_get1D(sampler);
+        const size_t j = size_t(x);
+        height[i] = 0.2f+0.05f*x;
+        for (size_t k=j; k<=j+1; k++)
+          height[i] = max(height[i],sqrt(max(0.0f,sqr(vertices[k].w)-sqr(x-float(k)))));
+        rays[i] = makeRay(Vec3fa(x,0.0f,-5.0f),Vec3fa(0.0f,0.0f,1.0f));
+      }
+      height[255] = 0.2f;
+      rays[255] = makeRay(Vec3fa(-5.0f,0.0f,0.0f),Vec3fa(1.0f,0.0f,0.0f));
+      IntersectWithMode(imode,ivariant,scene,rays,256);
+
+      for (size_t i=0; i<256; i++)
+      {
+        if (rays[i].geomID != geomID) return VerifyApplication::FAILED;
+        if (ivariant & VARIANT_OCCLUDED) continue;
+
+        if (abs(rays[i].tfar - (5.0f-height[i])) > 1E-3f) return VerifyApplication::FAILED;
+        if (dot(Vec3fa(rays[i].Ng[0],rays[i].Ng[1],rays[i].Ng[2]),Vec3fa(rays[i].dir[0],rays[i].dir[1],rays[i].dir[2])) >= 0.0f) 
+          return VerifyApplication::FAILED;
+        
+        /* the segment is ambiguous at the shared sphere joints */
+        const float x = rays[i].org[0];
+        if (i < 255 && x-floor(x) > 0.1f && x-floor(x) < 0.9f && rays[i].primID != unsigned(x))
+          return VerifyApplication::FAILED;
+      }
+
+      AssertNoError(device);
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct PresplitHairHitTest : public VerifyApplication::IntersectTest
+  {
+    bool surface;
+    float tessellationRate;
+
+    PresplitHairHitTest (std::string name, int isa, bool surface, float tessellationRate, IntersectMode imode, IntersectVariant ivariant)
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), surface(surface), tessellationRate(tessellationRate) {}
+
+    unsigned createCurve(RTCScene scene)
+    {
+      unsigned geomID = surface 
+        ? rtcNewBezierCurveGeometry(scene,RTC_GEOMETRY_STATIC,1,4,1)
+        : rtcNewBezierHairGeometry (scene,RTC_GEOMETRY_STATIC,1,4,1);
+      rtcSetTessellationRate(scene,geomID,tessellationRate);
+
+      /* straight curve along the x axis whose u parameter equals x/3 */
+      Vec3fa* vertices = (Vec3fa*) rtcMapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+      for (size_t i=0; i<4; i++) vertices[i] = Vec3fa(float(i),0.0f,0.0f,0.1f);
+      rtcUnmapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+      int* curves = (int*) rtcMapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+      curves[0] = 0;
+      rtcUnmapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+      rtcCommit (scene);
+      return geomID;
+    }
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      /* reference device uses the default hair acceleration structure */
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device0 = rtcNewDevice(cfg.c_str());
+      errorHandler(rtcDeviceGetError(device0));
+      RTCDeviceRef device1 = rtcNewDevice((cfg+",hair_accel=bvh4.bezier1s").c_str());
+      errorHandler(rtcDeviceGetError(device1));
+      if (!supportsIntersectMode(device1,imode))
+        return VerifyApplication::SKIPPED;
+
+      RTCSceneRef scene0 = rtcDeviceNewScene(device0,RTC_SCENE_STATIC,to_aflags(imode));
+      createCurve(scene0);
+      AssertNoError(device0);
+      RTCSceneRef scene1 = rtcDeviceNewScene(device1,RTC_SCENE_STATIC,to_aflags(imode));
+      unsigned geomID1 = createCurve(scene1);
+      AssertNoError(device1);
+
+      RTCRay rays0[256], rays1[256];
+      for (size_t i=0; i<256; i++) {
+        const float x = 0.1f+2.8f*RandomSampler_get1D(sampler);
+        rays0[i] = rays1[i] = makeRay(Vec3fa(x,0.0f,-5.0f),Vec3fa(0.0f,0.0f,1.0f));
+      }
+      IntersectWithMode(imode,ivariant,scene0,rays0,256);
+      IntersectWithMode(imode,ivariant,scene1,rays1,256);
+
+      for (size_t i=0; i<256; i++)
+      {
+        /* surface curves get intersected exactly like in the reference structure */
+        if (surface)
+        {
+          if (rays0[i].geomID != rays1[i].geomID) return VerifyApplication::FAILED;
+          if (rays1[i].geomID == RTC_INVALID_GEOMETRY_ID || (ivariant & VARIANT_OCCLUDED)) continue;
+          if (rays1[i].tfar != rays0[i].tfar || rays1[i].u != rays0[i].u) return VerifyApplication::FAILED;
+          continue;
+        }
+
+        if (rays1[i].geomID != geomID1) return VerifyApplication::FAILED;
+        if (ivariant & VARIANT_OCCLUDED) continue;
+        if (rays1[i].primID != 0) return VerifyApplication::FAILED;
+
+        /* hair hits the ray facing segments through the axis */
+        if (abs(rays1[i].tfar - 5.0f) > 1E-3f) return VerifyApplication::FAILED;
+
+        /* close to a segment end point the neighbouring segment may get reported */
+        if (abs(rays1[i].u - rays1[i].org[0]/3.0f) > 0.05f) return VerifyApplication::FAILED;
+      }
+
+      AssertNoError(device0);
+      AssertNoError(device1);
+      return VerifyApplication::PASSED;
+    }
+  };
+
   struct QuadHitTest : public VerifyApplication::IntersectTest
   {
     RTCSceneFlags sflags; 
@@ -2614,6 +3804,80 @@ namespace embree
     }
   };
   
+  struct CompressedHairTest : public VerifyApplication::IntersectTest
+  {
+    ALIGNED_STRUCT;
+    RTCSceneFlags sflags;
+    static const size_t N = 10;
+    static const size_t maxStreamSize = 100;
+    
+    CompressedHairTest (std::string name, int isa, RTCSceneFlags sflags, IntersectMode imode)
+      : VerifyApplication::IntersectTest(name,isa,imode,VARIANT_INTERSECT,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      if ((isa & AVX) != AVX)
+        return VerifyApplication::SKIPPED;
+
+      /* reference device uses uncompressed curves, test device uses quantized curve blocks */
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device0 = rtcNewDevice((cfg+",hair_accel=bvh8obb.bezier1v").c_str());
+      errorHandler(rtcDeviceGetError(device0));
+      RTCDeviceRef device1 = rtcNewDevice((cfg+",hair_accel=bvh8obb.bezier8q").c_str());
+      errorHandler(rtcDeviceGetError(device1));
+      if (!supportsIntersectMode(device0,imode))
+        return VerifyApplication::SKIPPED;
+
+      RandomSampler sampler0; RandomSampler_init(sampler0,0x1234);
+      RandomSampler sampler1; RandomSampler_init(sampler1,0x1234);
+      VerifyScene scene0(device0,sflags,to_aflags(imode));
+      VerifyScene scene1(device1,sflags,to_aflags(imode));
+      scene0.addHair(sampler0,RTC_GEOMETRY_STATIC,Vec3fa(-1.0f,0.5f,-1.0f),0.5f,0.01f,1000);
+      scene1.addHair(sampler1,RTC_GEOMETRY_STATIC,Vec3fa(-1.0f,0.5f,-1.0f),0.5f,0.01f,1000);
+      rtcCommit (scene0);
+      AssertNoError(device0);
+      rtcCommit (scene1);
+      AssertNoError(device1);
+      
+      size_t numTests = 0;
+      size_t numFailures = 0;
+      size_t numLostHits = 0;
+      for (auto ivariant : state->intersectVariants)
+      for (size_t i=0; i<size_t(N*state->intensity); i++) 
+      {
+        for (size_t M=1; M<maxStreamSize; M++)
+        {
+          __aligned(16) RTCRay rays0[maxStreamSize];
+          __aligned(16) RTCRay rays1[maxStreamSize];
+          for (size_t j=0; j<M; j++) 
+          {
+            Vec3fa org = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+            Vec3fa dir = 2.0f*random_Vec3fa() - Vec3fa(1.0f);
+            rays0[j] = rays1[j] = makeRay(org,dir); 
+          }
+          IntersectWithMode(imode,ivariant,scene0,rays0,M);
+          IntersectWithMode(imode,ivariant,scene1,rays1,M);
+          for (size_t j=0; j<M; j++) 
+          {
+            if (rays0[j].geomID == RTC_INVALID_GEOMETRY_ID && rays1[j].geomID == RTC_INVALID_GEOMETRY_ID) continue;
+            numTests++;
+            numFailures += rays0[j].geomID != rays1[j].geomID || rays0[j].primID != rays1[j].primID;
+            /* quantized curves enclose the original curves, thus no hit may get lost */
+            numLostHits += rays0[j].geomID != RTC_INVALID_GEOMETRY_ID && rays1[j].geomID == RTC_INVALID_GEOMETRY_ID;
+          }
+        }
+      }
+      AssertNoError(device0);
+      AssertNoError(device1);
+
+      /* slightly thicker quantized curves may hit a neighbouring curve first */
+      double failRate = double(numFailures) / double(max(numTests,size_t(1)));
+      bool failed = failRate > 0.01 || numLostHits != 0;
+      if (!silent) { printf(" (%f%%, %zu lost)", 100.0f*failRate, numLostHits); fflush(stdout); }
+      return (VerifyApplication::TestReturnValue)(!failed);
+    }
+  };
+  
   struct NaNTest : public VerifyApplication::IntersectTest
   {
     RTCSceneFlags sflags;
@@ -3982,6 +5246,22 @@ namespace embree
       groups.pop();
 
       groups.top()->add(new UnmappedBeforeCommitTest("unmapped_before_commit",isa));
+      groups.top()->add(new SoftwareCacheStatsTest("software_cache_stats",isa));
+      groups.top()->add(new TessellationCameraTest("tessellation_camera",isa));
+      groups.top()->add(new TaskingIdlePolicyTest("tasking_idle_policy",isa));
+      groups.top()->add(new CommitPriorityTest("commit_priority",isa));
+      groups.top()->add(new CancelCommitTest("cancel_commit_static",isa,RTC_SCENE_STATIC));
+      groups.top()->add(new CancelCommitTest("cancel_commit_dynamic",isa,RTC_SCENE_DYNAMIC));
+      groups.top()->add(new CommitAsyncTest("commit_async",isa));
+      groups.top()->add(new RebuildPresizingTest("rebuild_presizing",isa));
+      groups.top()->add(new MemoryRecycleTest("memory_recycle",isa));
+      groups.top()->add(new HugePagePolicyTest("huge_page_policy",isa));
+      groups.top()->add(new MemoryStatisticsTest("memory_statistics_static",isa,RTC_SCENE_STATIC));
+      groups.top()->add(new MemoryStatisticsTest("memory_statistics_dynamic",isa,RTC_SCENE_DYNAMIC));
+      groups.top()->add(new FlatBVHBuildTest("flat_bvh_build_low",isa,RTC_BUILD_QUALITY_LOW,2));
+      groups.top()->add(new FlatBVHBuildTest("flat_bvh_build_normal",isa,RTC_BUILD_QUALITY_NORMAL,4));
+      groups.top()->add(new FlatBVHBuildTest("flat_bvh_build_high",isa,RTC_BUILD_QUALITY_HIGH,8));
+      groups.top()->add(new MotionBlurBVHBuildTest("mblur_bvh_build",isa));
 
       push(new TestGroup("get_bounds",true,true));
       for (auto gtype : gtypes_all)
@@ -4080,6 +5360,11 @@ namespace embree
       for (auto s : interpolateTests)
         groups.top()->add(new InterpolateSubdivTest(std::to_string((long long)(s)),isa,s));
       groups.pop();
+
+      push(new TestGroup("subdiv_batch",true,true));
+      for (auto s : interpolateTests)
+        groups.top()->add(new InterpolateSubdivBatchTest(std::to_string((long long)(s)),isa,s));
+      groups.pop();
         
       push(new TestGroup("hair",true,true));
       for (auto s : interpolateTests) 
@@ -4100,6 +5385,40 @@ namespace embree
                 groups.top()->add(new TriangleHitTest(to_string(sflags,imode,ivariant),isa,sflags,RTC_GEOMETRY_STATIC,imode,ivariant));
       groups.pop();
       
+      push(new TestGroup("user_geometry_leaf_hit",true,true));
+      for (auto imode : intersectModes) 
+        for (auto ivariant : intersectVariants)
+          if (has_variant(imode,ivariant))
+            groups.top()->add(new UserGeometryLeafTest(to_string(imode,ivariant),isa,imode,ivariant));
+      groups.pop();
+
+      push(new TestGroup("round_line_hit",true,true));
+      for (auto imode : intersectModes) 
+        for (auto ivariant : intersectVariants)
+          if (has_variant(imode,ivariant))
+            groups.top()->add(new RoundLineHitTest(to_string(imode,ivariant),isa,imode,ivariant));
+      groups.pop();
+
+      push(new TestGroup("presplit_hair_hit",true,true));
+      for (auto surface : { false, true })
+        for (auto tessellationRate : { 1.0f, 4.0f, 12.0f })
+          for (auto imode : intersectModes) 
+            for (auto ivariant : intersectVariants)
+              if (has_variant(imode,ivariant))
+                groups.top()->add(new PresplitHairHitTest(std::string(surface ? "curve" : "hair")+"_"+std::to_string((long long)tessellationRate)
+                                                          +"_"+to_string(imode,ivariant),isa,surface,tessellationRate,imode,ivariant));
+      groups.pop();
+
+      push(new TestGroup("point_hit",true,true));
+      for (auto type : { PointHitTest::SPHERE, PointHitTest::DISC, PointHitTest::ORIENTED_DISC }) 
+        for (size_t numTimeSteps=1; numTimeSteps<=2; numTimeSteps++)
+          for (auto imode : intersectModes) 
+            for (auto ivariant : intersectVariants)
+              if (has_variant(imode,ivariant))
+                groups.top()->add(new PointHitTest(std::string(type == PointHitTest::SPHERE ? "sphere" : type == PointHitTest::DISC ? "disc" : "oriented_disc")
+                                                   +"_"+std::to_string(numTimeSteps)+"_"+to_string(imode,ivariant),isa,type,numTimeSteps,imode,ivariant));
+      groups.pop();
+
       push(new TestGroup("quad_hit",true,true));
       for (auto sflags : sceneFlags) 
         for (auto imode : intersectModes) 
@@ -4225,6 +5544,13 @@ namespace embree
         groups.pop();
       }
 
+      push(new TestGroup("compressed_hair",true,true)); {
+        for (auto sflags : sceneFlags) 
+          for (auto imode : intersectModes) 
+            groups.top()->add(new CompressedHairTest(to_string(sflags,imode),isa,sflags,imode));
+        groups.pop();
+      }
+
       if (rtcDeviceGetParameter1i(device,RTC_CONFIG_IGNORE_INVALID_RAYS))
       {
         push(new TestGroup("nan_test",true,false));